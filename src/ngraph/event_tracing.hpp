@@ -90,6 +90,8 @@ namespace ngraph
             m_stop = std::chrono::high_resolution_clock::now();
         }
 
+        void set_args(const std::string& args) { m_args = args; }
+
         static void write_trace(const Event& event);
         static bool is_tracing_enabled() { return s_tracing_enabled; }
         static void enable_event_tracing();
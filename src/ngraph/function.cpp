@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_set>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -95,9 +96,89 @@ void Function::init()
                    true /*include control dependencies*/);
 }
 
-std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
+// Appends the nodes of schedule that belong to ops to ordered_ops. Returns false unless that
+// covers every op and each node comes after the nodes it depends on.
+static bool apply_schedule(const vector<weak_ptr<Node>>& schedule,
+                           const list<shared_ptr<Node>>& ops,
+                           bool include_control_deps,
+                           vector<shared_ptr<Node>>& ordered_ops)
 {
-    return topological_sort(get_ops(include_control_deps), include_control_deps);
+    unordered_set<Node*> pending;
+    for (auto& node : ops)
+    {
+        pending.insert(node.get());
+    }
+    for (auto& weak_node : schedule)
+    {
+        auto node = weak_node.lock();
+        if (!node || pending.erase(node.get()) == 0)
+        {
+            continue;
+        }
+        for (auto& input : node->inputs())
+        {
+            if (pending.count(input.get_source_output().get_node()) != 0)
+            {
+                return false;
+            }
+        }
+        if (include_control_deps)
+        {
+            for (auto& dep : node->get_control_dependencies())
+            {
+                if (pending.count(dep.get()) != 0)
+                {
+                    return false;
+                }
+            }
+        }
+        ordered_ops.push_back(node);
+    }
+    return pending.empty();
+}
+
+vector<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
+{
+    return *get_ordered_ops_snapshot(include_control_deps);
+}
+
+shared_ptr<const vector<shared_ptr<Node>>>
+    Function::get_ordered_ops_snapshot(bool include_control_deps) const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    OrderedOpsCache& cache = m_ordered_ops_cache[include_control_deps ? 1 : 0];
+    // Read the version before sorting so that a concurrent edit marks the result stale
+    size_t graph_version = m_graph_version->load();
+    if (!cache.valid || cache.graph_version != graph_version)
+    {
+        // Callers may still hold the previous snapshot, so build a new one
+        auto ordered_ops = make_shared<vector<shared_ptr<Node>>>();
+        auto ops = get_ops(include_control_deps);
+        if (m_schedule.empty() ||
+            !apply_schedule(m_schedule, ops, include_control_deps, *ordered_ops))
+        {
+            auto sorted_ops = topological_sort(ops, include_control_deps);
+            ordered_ops->assign(sorted_ops.begin(), sorted_ops.end());
+        }
+        for (auto& node : *ordered_ops)
+        {
+            node->add_graph_version(m_graph_version);
+        }
+        cache.ops = ordered_ops;
+        cache.graph_version = graph_version;
+        cache.valid = true;
+    }
+    return cache.ops;
+}
+
+void Function::set_ordered_ops(const vector<shared_ptr<Node>>& ordered_ops)
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_schedule.assign(ordered_ops.begin(), ordered_ops.end());
+    for (OrderedOpsCache& cache : m_ordered_ops_cache)
+    {
+        cache.valid = false;
+    }
 }
 
 const std::string& Function::get_friendly_name() const
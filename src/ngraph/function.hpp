@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -87,7 +88,21 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
-        std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Returns the ops of the function in topological order.
+        ///
+        /// The order is cached and recomputed only when an edge or control dependency of one
+        /// of the ops has changed since it was last computed (see Node::add_graph_version).
+        std::vector<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Like get_ordered_ops(), but returns the cached order itself without copying
+        ///        it. A recomputed order replaces the snapshot rather than modifying it, so the
+        ///        returned vector stays valid and unchanged for as long as it is held.
+        std::shared_ptr<const std::vector<std::shared_ptr<Node>>>
+            get_ordered_ops_snapshot(bool include_control_deps = true) const;
+        /// \brief Fixes the order returned by get_ordered_ops(), e.g. to a memory friendly
+        ///        schedule. The order is kept for as long as it is a topological order of the
+        ///        ops of the function; once the graph changes in a way that breaks it,
+        ///        get_ordered_ops() sorts the ops again.
+        void set_ordered_ops(const std::vector<std::shared_ptr<Node>>& ordered_ops);
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -123,5 +138,18 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+
+        struct OrderedOpsCache
+        {
+            std::shared_ptr<const std::vector<std::shared_ptr<Node>>> ops;
+            size_t graph_version;
+            bool valid = false;
+        };
+        // Incremented by the ops of the cached orders whenever one of their edges changes
+        std::shared_ptr<std::atomic<size_t>> m_graph_version{
+            std::make_shared<std::atomic<size_t>>(0)};
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable OrderedOpsCache m_ordered_ops_cache[2];
+        std::vector<std::weak_ptr<Node>> m_schedule;
     };
 }
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <typeindex>
@@ -27,6 +28,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -232,6 +234,39 @@ const std::set<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     m_control_dependencies.insert(node);
+    increment_graph_version();
+}
+
+void Node::add_graph_version(const shared_ptr<atomic<size_t>>& graph_version)
+{
+    lock_guard<mutex> lock(m_graph_versions_mutex);
+    for (auto& registered : m_graph_versions)
+    {
+        if (registered.lock() == graph_version)
+        {
+            return;
+        }
+    }
+    m_graph_versions.push_back(graph_version);
+}
+
+void Node::increment_graph_version()
+{
+    // Versions of functions that no longer exist are dropped along the way
+    lock_guard<mutex> lock(m_graph_versions_mutex);
+    auto it = m_graph_versions.begin();
+    while (it != m_graph_versions.end())
+    {
+        if (auto graph_version = it->lock())
+        {
+            graph_version->fetch_add(1);
+            ++it;
+        }
+        else
+        {
+            it = m_graph_versions.erase(it);
+        }
+    }
 }
 
 std::vector<std::shared_ptr<Function>> Node::get_functions() const
@@ -239,6 +274,59 @@ std::vector<std::shared_ptr<Function>> Node::get_functions() const
     return std::vector<std::shared_ptr<Function>>{};
 }
 
+// Identifies the output read by each input
+static vector<pair<const Node*, size_t>> get_input_sources(const Node& node)
+{
+    vector<pair<const Node*, size_t>> sources;
+    for (auto input : node.inputs())
+    {
+        auto source = input.get_source_output();
+        sources.push_back({source.get_node(), source.get_index()});
+    }
+    if (node.is_commutative())
+    {
+        sort(sources.begin(), sources.end());
+    }
+    return sources;
+}
+
+size_t Node::get_structural_hash() const
+{
+    vector<size_t> values{type_index(typeid(*this)).hash_code(), get_attributes_hash()};
+    for (auto& source : get_input_sources(*this))
+    {
+        values.push_back(source.first->get_instance_id());
+        values.push_back(source.second);
+    }
+    for (auto output : outputs())
+    {
+        values.push_back(output.get_element_type().hash());
+        if (output.get_partial_shape().is_static())
+        {
+            values.push_back(hash_combine(output.get_shape()));
+        }
+    }
+    return hash_combine(values);
+}
+
+bool Node::is_structurally_equal(const Node& other) const
+{
+    if (typeid(*this) != typeid(other) || get_output_size() != other.get_output_size() ||
+        get_input_sources(*this) != get_input_sources(other))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < get_output_size(); ++i)
+    {
+        if (get_output_element_type(i) != other.get_output_element_type(i) ||
+            !get_output_partial_shape(i).same_scheme(other.get_output_partial_shape(i)))
+        {
+            return false;
+        }
+    }
+    return has_same_attributes(other);
+}
+
 namespace ngraph
 {
     ostream& operator<<(ostream& out, const Node& node)
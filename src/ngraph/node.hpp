@@ -20,6 +20,7 @@
 #include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <tuple>
@@ -177,9 +178,31 @@ namespace ngraph
         virtual bool is_constant() const;
         virtual bool is_null() const { return false; }
         virtual bool is_op() const { return false; }
-        virtual bool is_commutative() { return false; }
+        virtual bool is_commutative() const { return false; }
         virtual bool is_dynamic() const;
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Returns a hash of the op type, the outputs read by the inputs, the output
+        ///        types and the attributes. Structurally equal nodes have the same hash.
+        size_t get_structural_hash() const;
+        /// \brief Returns true if `other` is an op of the same type that reads the same outputs
+        ///        and has the same output types and attributes, so that both nodes compute the
+        ///        same values. The inputs of commutative ops may be in any order.
+        bool is_structurally_equal(const Node& other) const;
+        /// \brief Returns a hash of the attributes compared by has_same_attributes.
+        virtual size_t get_attributes_hash() const { return 0; }
+        /// \brief Returns true if `other`, a node of the same type, has the same attributes.
+        ///
+        /// Ops with attributes override this together with get_attributes_hash. The default
+        /// returns false, so ops that do not override it are never structurally equal.
+        virtual bool has_same_attributes(const Node& other) const { return false; }
+        /// \brief Registers the graph version of a function whose cached topological order
+        ///        includes this node. Changing an edge or control dependency of this node then
+        ///        increments that version, which marks the cached order stale.
+        void add_graph_version(const std::shared_ptr<std::atomic<size_t>>& graph_version);
+        /// \brief Marks the cached orders of the functions registered with add_graph_version
+        ///        stale. Call after modifying a graph by means other than the Node and
+        ///        descriptor::Input API.
+        void increment_graph_version();
         friend std::ostream& operator<<(std::ostream&, const Node&);
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
@@ -205,6 +228,7 @@ namespace ngraph
         void remove_control_dependency(std::shared_ptr<Node> node)
         {
             m_control_dependencies.erase(node);
+            increment_graph_version();
         }
 
         /// Returns the number of outputs from the node.
@@ -360,6 +384,9 @@ namespace ngraph
         std::string m_friendly_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        // Nodes can be shared by functions that are compiled concurrently
+        std::mutex m_graph_versions_mutex;
+        std::vector<std::weak_ptr<std::atomic<size_t>>> m_graph_versions;
         std::unordered_set<std::string> m_provenance_tags;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
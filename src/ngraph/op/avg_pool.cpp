@@ -194,3 +194,47 @@ void op::AvgPool::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVect
                                                      m_include_padding_in_avg_computation);
     adjoints.add_delta(operand, backprop);
 }
+
+size_t op::AvgPool::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_window_shape),
+         hash_combine(m_window_movement_strides),
+         hash_combine(m_padding_below),
+         hash_combine(m_padding_above),
+         static_cast<size_t>(m_include_padding_in_avg_computation),
+         static_cast<size_t>(m_pad_type)});
+}
+
+bool op::AvgPool::has_same_attributes(const Node& other) const
+{
+    auto& avg_pool = static_cast<const AvgPool&>(other);
+    return m_window_shape == avg_pool.m_window_shape &&
+           m_window_movement_strides == avg_pool.m_window_movement_strides &&
+           m_padding_below == avg_pool.m_padding_below &&
+           m_padding_above == avg_pool.m_padding_above &&
+           m_include_padding_in_avg_computation == avg_pool.m_include_padding_in_avg_computation &&
+           m_pad_type == avg_pool.m_pad_type;
+}
+
+size_t op::AvgPoolBackprop::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_forward_arg_shape),
+         hash_combine(m_window_shape),
+         hash_combine(m_window_movement_strides),
+         hash_combine(m_padding_below),
+         hash_combine(m_padding_above),
+         static_cast<size_t>(m_include_padding_in_avg_computation)});
+}
+
+bool op::AvgPoolBackprop::has_same_attributes(const Node& other) const
+{
+    auto& avg_pool = static_cast<const AvgPoolBackprop&>(other);
+    return m_forward_arg_shape == avg_pool.m_forward_arg_shape &&
+           m_window_shape == avg_pool.m_window_shape &&
+           m_window_movement_strides == avg_pool.m_window_movement_strides &&
+           m_padding_below == avg_pool.m_padding_below &&
+           m_padding_above == avg_pool.m_padding_above &&
+           m_include_padding_in_avg_computation == avg_pool.m_include_padding_in_avg_computation;
+}
@@ -260,3 +260,36 @@ std::shared_ptr<ngraph::Node>
                                                            new_args.at(5),
                                                            m_epsilon);
 }
+
+size_t ngraph::op::BatchNormTraining::get_attributes_hash() const
+{
+    return std::hash<double>()(m_epsilon);
+}
+
+bool ngraph::op::BatchNormTraining::has_same_attributes(const Node& other) const
+{
+    auto& batch_norm = static_cast<const BatchNormTraining&>(other);
+    return m_epsilon == batch_norm.m_epsilon;
+}
+
+size_t ngraph::op::BatchNormInference::get_attributes_hash() const
+{
+    return std::hash<double>()(m_epsilon);
+}
+
+bool ngraph::op::BatchNormInference::has_same_attributes(const Node& other) const
+{
+    auto& batch_norm = static_cast<const BatchNormInference&>(other);
+    return m_epsilon == batch_norm.m_epsilon;
+}
+
+size_t ngraph::op::BatchNormTrainingBackprop::get_attributes_hash() const
+{
+    return std::hash<double>()(m_epsilon);
+}
+
+bool ngraph::op::BatchNormTrainingBackprop::has_same_attributes(const Node& other) const
+{
+    auto& batch_norm = static_cast<const BatchNormTrainingBackprop&>(other);
+    return m_epsilon == batch_norm.m_epsilon;
+}
@@ -69,6 +69,8 @@ namespace ngraph
             double get_eps_value() const { return m_epsilon; }
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
         protected:
             virtual void generate_adjoints(autodiff::Adjoints& adjoints,
@@ -128,6 +130,8 @@ namespace ngraph
             double get_eps_value() const { return m_epsilon; }
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
         protected:
             virtual void generate_adjoints(autodiff::Adjoints& adjoints,
@@ -172,6 +176,8 @@ namespace ngraph
             double get_eps_value() const { return m_epsilon; }
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
         private:
             static constexpr size_t INPUT_GAMMA = 0;
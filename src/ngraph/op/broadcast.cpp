@@ -16,6 +16,7 @@
 
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/sum.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -137,3 +138,23 @@ void op::BroadcastLike::infer_shape()
         }
     }
 }
+
+size_t op::Broadcast::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_shape),
+         hash_combine(vector<size_t>(m_broadcast_axes.begin(), m_broadcast_axes.end()))});
+}
+
+bool op::Broadcast::has_same_attributes(const Node& other) const
+{
+    auto& broadcast = static_cast<const Broadcast&>(other);
+    return m_shape == broadcast.m_shape && m_broadcast_axes == broadcast.m_broadcast_axes;
+}
+
+bool op::BroadcastLike::has_same_attributes(const Node& other) const
+{
+    auto& broadcast_like = static_cast<const BroadcastLike&>(other);
+    return Broadcast::has_same_attributes(other) &&
+           m_initial_broadcast_axes == broadcast_like.m_initial_broadcast_axes;
+}
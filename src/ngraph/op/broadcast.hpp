@@ -41,6 +41,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
             /// \return A set containing the indices of the broadcast axes (0-based).
             const AxisSet& get_broadcast_axes() const { return m_broadcast_axes; }
@@ -78,6 +80,7 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            bool has_same_attributes(const Node& other) const override;
 
             void infer_shape() override;
             const AxisSet& get_initial_broadcast_axes() const { return m_initial_broadcast_axes; }
@@ -123,3 +123,13 @@ void op::Concat::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVecto
         pos = next_pos;
     }
 }
+
+size_t op::Concat::get_attributes_hash() const
+{
+    return m_concatenation_axis;
+}
+
+bool op::Concat::has_same_attributes(const Node& other) const
+{
+    return m_concatenation_axis == static_cast<const Concat&>(other).m_concatenation_axis;
+}
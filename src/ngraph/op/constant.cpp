@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
@@ -225,6 +226,36 @@ shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) co
     return make_shared<Constant>(m_element_type, m_shape, m_data->get_ptr());
 }
 
+size_t op::Constant::get_attributes_hash() const
+{
+    const char* data = static_cast<const char*>(get_data_ptr());
+    size_t size = shape_size(m_shape) * m_element_type.size();
+    uint64_t hash = hash_combine({m_element_type.hash(), hash_combine(m_shape)});
+    // Mix in the contents a word at a time so that hashing large weights stays cheap
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ULL;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; ++i)
+    {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+bool op::Constant::has_same_attributes(const Node& other) const
+{
+    auto& constant = static_cast<const Constant&>(other);
+    return m_element_type == constant.m_element_type && m_shape == constant.m_shape &&
+           memcmp(get_data_ptr(),
+                  constant.get_data_ptr(),
+                  shape_size(m_shape) * m_element_type.size()) == 0;
+}
+
 template <typename T>
 static bool test_bitwise_identical(const op::Constant* constant)
 {
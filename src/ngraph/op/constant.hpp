@@ -213,6 +213,9 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            /// \brief Returns a hash of the element type, shape and contents of the constant.
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
             /// \return The initialization literals for the tensor constant.
             std::vector<std::string> get_value_strings() const;
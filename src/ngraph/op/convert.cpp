@@ -47,3 +47,13 @@ void op::Convert::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVect
 
     adjoints.add_delta(x, make_shared<op::Convert>(delta, x->get_element_type()));
 }
+
+size_t op::Convert::get_attributes_hash() const
+{
+    return m_element_type.hash();
+}
+
+bool op::Convert::has_same_attributes(const Node& other) const
+{
+    return m_element_type == static_cast<const Convert&>(other).m_element_type;
+}
@@ -36,6 +36,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
             const element::Type& get_convert_element_type() const { return m_element_type; }
         protected:
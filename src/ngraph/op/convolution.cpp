@@ -849,3 +849,71 @@ Shape op::util::infer_convolution_output_shape(const Node* node,
 
     return result_shape;
 }
+
+size_t op::Convolution::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_window_movement_strides),
+         hash_combine(m_window_dilation_strides),
+         hash_combine(vector<size_t>(m_padding_below.begin(), m_padding_below.end())),
+         hash_combine(vector<size_t>(m_padding_above.begin(), m_padding_above.end())),
+         hash_combine(m_data_dilation_strides),
+         static_cast<size_t>(m_pad_type)});
+}
+
+bool op::Convolution::has_same_attributes(const Node& other) const
+{
+    auto& conv = static_cast<const Convolution&>(other);
+    return m_window_movement_strides == conv.m_window_movement_strides &&
+           m_window_dilation_strides == conv.m_window_dilation_strides &&
+           m_padding_below == conv.m_padding_below && m_padding_above == conv.m_padding_above &&
+           m_data_dilation_strides == conv.m_data_dilation_strides && m_pad_type == conv.m_pad_type;
+}
+
+size_t op::ConvolutionBackpropData::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_data_batch_shape),
+         hash_combine(m_window_movement_strides_forward),
+         hash_combine(m_window_dilation_strides_forward),
+         hash_combine(
+             vector<size_t>(m_padding_below_forward.begin(), m_padding_below_forward.end())),
+         hash_combine(
+             vector<size_t>(m_padding_above_forward.begin(), m_padding_above_forward.end())),
+         hash_combine(m_data_dilation_strides_forward)});
+}
+
+bool op::ConvolutionBackpropData::has_same_attributes(const Node& other) const
+{
+    auto& conv = static_cast<const ConvolutionBackpropData&>(other);
+    return m_data_batch_shape == conv.m_data_batch_shape &&
+           m_window_movement_strides_forward == conv.m_window_movement_strides_forward &&
+           m_window_dilation_strides_forward == conv.m_window_dilation_strides_forward &&
+           m_padding_below_forward == conv.m_padding_below_forward &&
+           m_padding_above_forward == conv.m_padding_above_forward &&
+           m_data_dilation_strides_forward == conv.m_data_dilation_strides_forward;
+}
+
+size_t op::ConvolutionBackpropFilters::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_filters_shape),
+         hash_combine(m_window_movement_strides_forward),
+         hash_combine(m_window_dilation_strides_forward),
+         hash_combine(
+             vector<size_t>(m_padding_below_forward.begin(), m_padding_below_forward.end())),
+         hash_combine(
+             vector<size_t>(m_padding_above_forward.begin(), m_padding_above_forward.end())),
+         hash_combine(m_data_dilation_strides_forward)});
+}
+
+bool op::ConvolutionBackpropFilters::has_same_attributes(const Node& other) const
+{
+    auto& conv = static_cast<const ConvolutionBackpropFilters&>(other);
+    return m_filters_shape == conv.m_filters_shape &&
+           m_window_movement_strides_forward == conv.m_window_movement_strides_forward &&
+           m_window_dilation_strides_forward == conv.m_window_dilation_strides_forward &&
+           m_padding_below_forward == conv.m_padding_below_forward &&
+           m_padding_above_forward == conv.m_padding_above_forward &&
+           m_data_dilation_strides_forward == conv.m_data_dilation_strides_forward;
+}
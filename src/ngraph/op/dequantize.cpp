@@ -16,6 +16,7 @@
 
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -159,3 +160,15 @@ void op::Dequantize::generate_adjoints(autodiff::Adjoints& adjoints, const NodeV
 {
     throw ngraph_error("Forward-propagation-only operation");
 }
+
+size_t op::Dequantize::get_attributes_hash() const
+{
+    return hash_combine(
+        {m_type.hash(), hash_combine(vector<size_t>(m_axes.begin(), m_axes.end()))});
+}
+
+bool op::Dequantize::has_same_attributes(const Node& other) const
+{
+    auto& dequantize = static_cast<const Dequantize&>(other);
+    return m_type == dequantize.m_type && m_axes == dequantize.m_axes;
+}
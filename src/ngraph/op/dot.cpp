@@ -202,3 +202,13 @@ void op::Dot::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector&
     auto x_reshaped_dot_delta = make_shared<Dot>(x_reshaped, delta, I_shape.size()); // JI.IK->JK
     adjoints.add_delta(y, x_reshaped_dot_delta);
 }
+
+size_t op::Dot::get_attributes_hash() const
+{
+    return m_reduction_axes_count;
+}
+
+bool op::Dot::has_same_attributes(const Node& other) const
+{
+    return m_reduction_axes_count == static_cast<const Dot&>(other).m_reduction_axes_count;
+}
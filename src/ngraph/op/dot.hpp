@@ -51,6 +51,8 @@ namespace ngraph
             Dot(const std::shared_ptr<Node>& arg0, const std::shared_ptr<Node>& arg1);
 
             void validate_and_infer_types() override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
             size_t get_reduction_axes_count() const { return m_reduction_axes_count; }
             virtual std::shared_ptr<Node>
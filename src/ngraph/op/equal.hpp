@@ -47,6 +47,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+
+            virtual bool is_commutative() const override { return true; }
         };
     }
 }
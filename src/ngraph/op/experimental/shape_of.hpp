@@ -31,6 +31,7 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            bool has_same_attributes(const Node&) const override { return true; }
 
         protected:
             void validate_and_infer_types() override;
@@ -80,3 +80,13 @@ void op::Gather::validate_and_infer_types()
 
     set_output_type(0, result_et, result_shape);
 }
+
+size_t op::Gather::get_attributes_hash() const
+{
+    return m_axis;
+}
+
+bool op::Gather::has_same_attributes(const Node& other) const
+{
+    return m_axis == static_cast<const Gather&>(other).m_axis;
+}
@@ -48,6 +48,8 @@ namespace ngraph
             size_t get_axis() const { return m_axis; }
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
         protected:
             size_t m_axis;
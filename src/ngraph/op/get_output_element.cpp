@@ -70,3 +70,13 @@ NodeVector op::get_output_elements(const shared_ptr<Node>& mon)
     }
     return goes;
 }
+
+size_t op::GetOutputElement::get_attributes_hash() const
+{
+    return m_n;
+}
+
+bool op::GetOutputElement::has_same_attributes(const Node& other) const
+{
+    return m_n == static_cast<const GetOutputElement&>(other).m_n;
+}
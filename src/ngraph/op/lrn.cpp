@@ -16,6 +16,7 @@
 
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/multiply.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -54,3 +55,17 @@ void op::LRN::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector&
 {
     throw ngraph_error("NYI");
 }
+
+size_t op::LRN::get_attributes_hash() const
+{
+    hash<double> double_hash;
+    return hash_combine(
+        {double_hash(m_alpha), double_hash(m_beta), double_hash(m_bias), m_size});
+}
+
+bool op::LRN::has_same_attributes(const Node& other) const
+{
+    auto& lrn = static_cast<const LRN&>(other);
+    return m_alpha == lrn.m_alpha && m_beta == lrn.m_beta && m_bias == lrn.m_bias &&
+           m_size == lrn.m_size;
+}
@@ -49,6 +49,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
             double get_alpha() const { return m_alpha; }
             double get_beta() const { return m_beta; }
@@ -232,3 +232,40 @@ void op::MaxPool::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVect
 
     adjoints.add_delta(operand, backprop);
 }
+
+size_t op::MaxPool::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_window_shape),
+         hash_combine(m_window_movement_strides),
+         hash_combine(m_padding_below),
+         hash_combine(m_padding_above),
+         static_cast<size_t>(m_pad_type)});
+}
+
+bool op::MaxPool::has_same_attributes(const Node& other) const
+{
+    auto& max_pool = static_cast<const MaxPool&>(other);
+    return m_window_shape == max_pool.m_window_shape &&
+           m_window_movement_strides == max_pool.m_window_movement_strides &&
+           m_padding_below == max_pool.m_padding_below &&
+           m_padding_above == max_pool.m_padding_above && m_pad_type == max_pool.m_pad_type;
+}
+
+size_t op::MaxPoolBackprop::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_window_shape),
+         hash_combine(m_window_movement_strides),
+         hash_combine(m_padding_below),
+         hash_combine(m_padding_above)});
+}
+
+bool op::MaxPoolBackprop::has_same_attributes(const Node& other) const
+{
+    auto& max_pool = static_cast<const MaxPoolBackprop&>(other);
+    return m_window_shape == max_pool.m_window_shape &&
+           m_window_movement_strides == max_pool.m_window_movement_strides &&
+           m_padding_below == max_pool.m_padding_below &&
+           m_padding_above == max_pool.m_padding_above;
+}
@@ -173,3 +173,18 @@ std::shared_ptr<Node> op::Pad::get_default_value() const
     }
     return std::make_shared<op::Broadcast>(get_argument(1), get_shape(), axes);
 }
+
+size_t op::Pad::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(vector<size_t>(m_padding_below.begin(), m_padding_below.end())),
+         hash_combine(vector<size_t>(m_padding_above.begin(), m_padding_above.end())),
+         static_cast<size_t>(m_pad_mode)});
+}
+
+bool op::Pad::has_same_attributes(const Node& other) const
+{
+    auto& pad = static_cast<const Pad&>(other);
+    return m_padding_below == pad.m_padding_below && m_padding_above == pad.m_padding_above &&
+           m_padding_interior_fake == pad.m_padding_interior_fake && m_pad_mode == pad.m_pad_mode;
+}
@@ -16,6 +16,7 @@
 
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -162,3 +163,18 @@ void op::Quantize::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVec
 {
     throw ngraph_error("Forward-propagation-only operation");
 }
+
+size_t op::Quantize::get_attributes_hash() const
+{
+    return hash_combine(
+        {m_type.hash(),
+         hash_combine(vector<size_t>(m_axes.begin(), m_axes.end())),
+         static_cast<size_t>(m_round_mode)});
+}
+
+bool op::Quantize::has_same_attributes(const Node& other) const
+{
+    auto& quantize = static_cast<const Quantize&>(other);
+    return m_type == quantize.m_type && m_axes == quantize.m_axes &&
+           m_round_mode == quantize.m_round_mode;
+}
@@ -93,6 +93,8 @@ namespace ngraph
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
 
             const ngraph::AxisSet& get_axes() const { return m_axes; }
             RoundMode get_round_mode() const { return m_round_mode; }
@@ -20,6 +20,7 @@
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -144,3 +145,14 @@ void op::Reshape::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVect
 
     adjoints.add_delta(get_argument(0), reshape);
 }
+
+size_t op::Reshape::get_attributes_hash() const
+{
+    return hash_combine({hash_combine(m_input_order), hash_combine(m_output_shape)});
+}
+
+bool op::Reshape::has_same_attributes(const Node& other) const
+{
+    auto& reshape = static_cast<const Reshape&>(other);
+    return m_input_order == reshape.m_input_order && m_output_shape == reshape.m_output_shape;
+}
@@ -19,6 +19,7 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/op/reverse.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -67,3 +68,13 @@ void op::Reverse::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVect
 
     adjoints.add_delta(x, make_shared<op::Reverse>(delta, m_reversed_axes));
 }
+
+size_t op::Reverse::get_attributes_hash() const
+{
+    return hash_combine(vector<size_t>(m_reversed_axes.begin(), m_reversed_axes.end()));
+}
+
+bool op::Reverse::has_same_attributes(const Node& other) const
+{
+    return m_reversed_axes == static_cast<const Reverse&>(other).m_reversed_axes;
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/op/slice.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -137,3 +138,16 @@ void op::Slice::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector
 
     adjoints.add_delta_to_slice(x, delta, m_lower_bounds, m_upper_bounds, m_strides);
 }
+
+size_t op::Slice::get_attributes_hash() const
+{
+    return hash_combine(
+        {hash_combine(m_lower_bounds), hash_combine(m_upper_bounds), hash_combine(m_strides)});
+}
+
+bool op::Slice::has_same_attributes(const Node& other) const
+{
+    auto& slice = static_cast<const Slice&>(other);
+    return m_lower_bounds == slice.m_lower_bounds && m_upper_bounds == slice.m_upper_bounds &&
+           m_strides == slice.m_strides;
+}
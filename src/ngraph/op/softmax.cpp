@@ -90,3 +90,13 @@ void op::Softmax::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVect
     auto x = get_argument(0);
     adjoints.add_delta(x, adjoint);
 }
+
+size_t op::Softmax::get_attributes_hash() const
+{
+    return hash_combine(vector<size_t>(m_axes.begin(), m_axes.end()));
+}
+
+bool op::Softmax::has_same_attributes(const Node& other) const
+{
+    return m_axes == static_cast<const Softmax&>(other).m_axes;
+}
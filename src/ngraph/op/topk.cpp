@@ -19,6 +19,7 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/op/topk.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -104,3 +105,16 @@ void op::TopK::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector&
 {
     throw ngraph_error("Forward-propagation-only operation");
 }
+
+size_t op::TopK::get_attributes_hash() const
+{
+    return hash_combine(
+        {m_top_k_axis, m_index_element_type.hash(), m_k, static_cast<size_t>(m_compute_max)});
+}
+
+bool op::TopK::has_same_attributes(const Node& other) const
+{
+    auto& topk = static_cast<const TopK&>(other);
+    return m_top_k_axis == topk.m_top_k_axis && m_index_element_type == topk.m_index_element_type &&
+           m_k == topk.m_k && m_compute_max == topk.m_compute_max;
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -65,3 +66,13 @@ void op::util::ArithmeticReduction::validate_and_infer_types()
 
     set_output_type(0, get_input_element_type(0), result_shape);
 }
+
+size_t op::util::ArithmeticReduction::get_attributes_hash() const
+{
+    return hash_combine(vector<size_t>(m_reduction_axes.begin(), m_reduction_axes.end()));
+}
+
+bool op::util::ArithmeticReduction::has_same_attributes(const Node& other) const
+{
+    return m_reduction_axes == static_cast<const ArithmeticReduction&>(other).m_reduction_axes;
+}
@@ -55,6 +55,7 @@ namespace ngraph
                                          const std::shared_ptr<Node>& arg1);
 
                 void validate_and_infer_types() override;
+                bool has_same_attributes(const Node&) const override { return true; }
             };
         }
     }
@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "ngraph/op/util/index_reduction.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -77,3 +78,15 @@ void op::util::IndexReduction::generate_adjoints(autodiff::Adjoints& adjoints,
 {
     throw ngraph_error("Forward-propagation-only operation");
 }
+
+size_t op::util::IndexReduction::get_attributes_hash() const
+{
+    return hash_combine({m_axis, m_index_element_type.hash()});
+}
+
+bool op::util::IndexReduction::has_same_attributes(const Node& other) const
+{
+    auto& index_reduction = static_cast<const IndexReduction&>(other);
+    return m_axis == index_reduction.m_axis &&
+           m_index_element_type == index_reduction.m_index_element_type;
+}
@@ -33,6 +33,8 @@ namespace ngraph
                                const std::shared_ptr<Node>& arg,
                                size_t axis,
                                const element::Type& index_element_type);
+                size_t get_attributes_hash() const override;
+                bool has_same_attributes(const Node& other) const override;
 
             protected:
                 size_t m_axis;
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/op/util/logical_reduction.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -69,3 +70,13 @@ void op::util::LogicalReduction::validate_and_infer_types()
 
     set_output_type(0, element::boolean, result_shape);
 }
+
+size_t op::util::LogicalReduction::get_attributes_hash() const
+{
+    return hash_combine(vector<size_t>(m_reduction_axes.begin(), m_reduction_axes.end()));
+}
+
+bool op::util::LogicalReduction::has_same_attributes(const Node& other) const
+{
+    return m_reduction_axes == static_cast<const LogicalReduction&>(other).m_reduction_axes;
+}
@@ -38,6 +38,8 @@ namespace ngraph
                                  const AxisSet& reduction_axes);
 
                 void validate_and_infer_types() override;
+                size_t get_attributes_hash() const override;
+                bool has_same_attributes(const Node& other) const override;
 
                 /// \return The axis positions (0-based) to be eliminated through reduction.
                 const AxisSet& get_reduction_axes() const { return m_reduction_axes; }
@@ -34,6 +34,7 @@ public:
         : FunctionPass()
     {
         set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+        set_property(PassProperty::THREAD_SAFE, true);
     }
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 };
@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include <stdint.h>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "constant_folding.hpp"
 #include "ngraph/graph_util.hpp"
@@ -26,6 +28,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
+#include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
@@ -34,6 +37,7 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -54,6 +58,7 @@
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/runtime/reference/sqrt.hpp"
 #include "ngraph/runtime/reference/subtract.hpp"
+#include "ngraph/runtime/tensor.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -951,3 +956,206 @@ void pass::ConstantFolding::construct_constant_shape_of()
         make_shared<pattern::Matcher>(shape_of_op, "ConstantFolding.ConstantShapeOf");
     this->add_matcher(shape_of_matcher, constant_shape_of_callback, all_pass_property_off);
 }
+
+bool pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    // Hold the original ops so that their addresses stay unique while comparing
+    unordered_set<shared_ptr<Node>> ops_before;
+    for (auto& node : f->get_ops())
+    {
+        ops_before.insert(node);
+    }
+
+    bool rc = GraphRewrite::run_on_function(f);
+    if (m_enable_generic)
+    {
+        rc = fold_generic(f) || rc;
+    }
+
+    if (rc)
+    {
+        unordered_set<Node*> ops_after;
+        size_t folded_bytes = 0;
+        for (auto& node : f->get_ops())
+        {
+            ops_after.insert(node.get());
+            if (node->is_constant() && ops_before.count(node) == 0)
+            {
+                folded_bytes += shape_size(node->get_shape()) *
+                                node->get_element_type().size();
+            }
+        }
+        size_t folded_op_count = 0;
+        for (auto& node : ops_before)
+        {
+            if (!node->is_constant() && ops_after.count(node.get()) == 0)
+            {
+                folded_op_count++;
+            }
+        }
+        NGRAPH_DEBUG << "ConstantFolding folded " << folded_op_count << " ops into "
+                     << folded_bytes << " bytes of constants in " << f->get_name();
+        m_folded_op_count += folded_op_count;
+        m_folded_bytes += folded_bytes;
+    }
+    return rc;
+}
+
+void pass::ConstantFolding::check_generic() const
+{
+    NGRAPH_CHECK(!m_enable_generic || m_evaluator,
+                 "Generic constant folding needs a ConstantEvaluator");
+}
+
+// Ops of the core opset that always compute the same outputs from the same inputs
+static bool is_pure_op(const Node& node)
+{
+    static const unordered_set<string> pure_op_names = [] {
+        unordered_set<string> names{
+#define NGRAPH_OP(a, b) #a,
+#include "ngraph/op/op_tbl.hpp"
+#undef NGRAPH_OP
+        };
+        for (const char* name : {"AllReduce",
+                                 "BroadcastDistributed",
+                                 "Constant",
+                                 "GenerateMask",
+                                 "Parameter",
+                                 "Passthrough",
+                                 "Result"})
+        {
+            names.erase(name);
+        }
+        return names;
+    }();
+    return pure_op_names.count(node.description()) != 0;
+}
+
+// Clones `nodes`, which must be topologically sorted and have only constants and each other
+// as arguments, runs them with `evaluator` and returns the values of `targets` as constants.
+static vector<shared_ptr<op::Constant>>
+    evaluate_constant_ops(const pass::ConstantFolding::ConstantEvaluator& evaluator,
+                          const vector<shared_ptr<Node>>& nodes,
+                          const vector<shared_ptr<Node>>& targets)
+{
+    unordered_map<Node*, shared_ptr<Node>> clones;
+    for (auto& node : nodes)
+    {
+        NodeVector args;
+        for (auto& arg : node->get_arguments())
+        {
+            auto it = clones.find(arg.get());
+            args.push_back(it == clones.end() ? arg : it->second);
+        }
+        clones[node.get()] = node->copy_with_new_args(args);
+    }
+
+    ResultVector results;
+    for (auto& target : targets)
+    {
+        results.push_back(make_shared<op::Result>(clones.at(target.get())));
+    }
+    auto constants = evaluator(make_shared<Function>(results, ParameterVector{}));
+    NGRAPH_CHECK(constants.size() == targets.size(),
+                 "ConstantEvaluator returned ",
+                 constants.size(),
+                 " constants for ",
+                 targets.size(),
+                 " results");
+    return constants;
+}
+
+bool pass::ConstantFolding::fold_generic(const shared_ptr<Function>& f)
+{
+    // Ops whose inputs are all known at compile time, in topological order
+    vector<shared_ptr<Node>> foldable;
+    unordered_set<Node*> is_foldable;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (!is_pure_op(*node) || node->get_input_size() == 0 ||
+            !node->get_control_dependencies().empty())
+        {
+            continue;
+        }
+        bool constant_inputs = true;
+        for (auto& arg : node->get_arguments())
+        {
+            constant_inputs &= arg->is_constant() || is_foldable.count(arg.get()) != 0;
+        }
+        for (auto output : node->outputs())
+        {
+            constant_inputs &= output.get_partial_shape().is_static() &&
+                               output.get_element_type().is_static() &&
+                               shape_size(output.get_shape()) * output.get_element_type().size() <=
+                                   m_max_folded_bytes;
+        }
+        if (constant_inputs)
+        {
+            foldable.push_back(node);
+            is_foldable.insert(node.get());
+        }
+    }
+
+    // The foldable ops read by the rest of the graph are replaced by constants. The values of
+    // multi-output ops are replaced through their GetOutputElement users.
+    vector<shared_ptr<Node>> targets;
+    for (auto& node : foldable)
+    {
+        if (node->get_output_size() != 1)
+        {
+            continue;
+        }
+        for (auto& user : node->get_users())
+        {
+            if (is_foldable.count(user.get()) == 0)
+            {
+                targets.push_back(node);
+                break;
+            }
+        }
+    }
+    if (targets.empty())
+    {
+        return false;
+    }
+
+    try
+    {
+        auto constants = evaluate_constant_ops(m_evaluator, foldable, targets);
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            replace_node(targets[i], constants[i]);
+        }
+        return true;
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "Folding constant subgraph of " << f->get_name()
+                     << " failed, folding op by op: " << e.what();
+    }
+
+    // Some op could not be evaluated; fold everything else one op at a time
+    bool rc = false;
+    for (auto& node : foldable)
+    {
+        bool constant_inputs = node->get_output_size() == 1;
+        for (auto& arg : node->get_arguments())
+        {
+            constant_inputs &= arg->is_constant();
+        }
+        if (!constant_inputs)
+        {
+            continue;
+        }
+        try
+        {
+            replace_node(node, evaluate_constant_ops(m_evaluator, {node}, {node}).at(0));
+            rc = true;
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_DEBUG << "Cannot fold " << node->get_name() << ": " << e.what();
+        }
+    }
+    return rc;
+}
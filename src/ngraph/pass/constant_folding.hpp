@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <functional>
+
+#include "ngraph/op/constant.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/util.hpp"
 
@@ -40,13 +43,34 @@ public:
         BINARY,
         QUANTIZE,
         CONVERT,
-        SHAPE_OF
+        SHAPE_OF,
+        GENERIC
     };
 
-    ConstantFolding(const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap())
+    /// \brief Computes the results of a Function that has no parameters, one constant per
+    ///        result. Throws if the function cannot be evaluated.
+    using ConstantEvaluator = std::function<std::vector<std::shared_ptr<ngraph::op::Constant>>(
+        const std::shared_ptr<ngraph::Function>&)>;
+
+    static const size_t default_max_folded_bytes = 16 * 1024 * 1024;
+
+    /// \param cfmap Executors for the op types folded by the matchers
+    /// \param enable_generic Also fold every pure op whose inputs are all constant. The ops
+    ///        are evaluated by `evaluator`, which must be given.
+    /// \param evaluator Evaluates the constant subgraphs found by the generic step
+    /// \param max_folded_bytes Size in bytes of the largest constant the generic step may
+    ///        create. Ops with a larger output are left to be computed at runtime.
+    ConstantFolding(const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap(),
+                    bool enable_generic = false,
+                    const ConstantEvaluator& evaluator = nullptr,
+                    size_t max_folded_bytes = default_max_folded_bytes)
         : GraphRewrite()
+        , m_cfmap(cfmap)
+        , m_evaluator(evaluator)
+        , m_enable_generic(enable_generic)
+        , m_max_folded_bytes(max_folded_bytes)
     {
-        m_cfmap = cfmap;
+        check_generic();
         construct_constant_reshape();
         construct_constant_broadcast();
         construct_constant_pad();
@@ -60,11 +84,16 @@ public:
 
     //this allows to specify the order in which matchers will be run
     //and also allows to register the same matcher more than once
+    //CFTransformations::GENERIC needs `evaluator`
     ConstantFolding(const std::vector<CFTransformations>& transformations,
-                    const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap())
+                    const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap(),
+                    const ConstantEvaluator& evaluator = nullptr,
+                    size_t max_folded_bytes = default_max_folded_bytes)
         : GraphRewrite()
+        , m_cfmap(cfmap)
+        , m_evaluator(evaluator)
+        , m_max_folded_bytes(max_folded_bytes)
     {
-        m_cfmap = cfmap;
         for (auto cft : transformations)
         {
             switch (cft)
@@ -78,10 +107,19 @@ public:
             case CFTransformations::QUANTIZE: construct_constant_quantize(); break;
             case CFTransformations::CONVERT: construct_constant_convert(); break;
             case CFTransformations::SHAPE_OF: construct_constant_shape_of(); break;
+            case CFTransformations::GENERIC: m_enable_generic = true; break;
             }
         }
+        check_generic();
     }
 
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    size_t get_max_folded_bytes() const { return m_max_folded_bytes; }
+    /// \brief Returns the number of ops removed by all runs of this pass.
+    size_t get_folded_op_count() const { return m_folded_op_count; }
+    /// \brief Returns the size in bytes of the constants created by all runs of this pass.
+    size_t get_folded_bytes() const { return m_folded_bytes; }
 private:
     void construct_constant_reshape();
     void construct_constant_broadcast();
@@ -92,6 +130,14 @@ private:
     void construct_constant_dequantize();
     void construct_constant_convert();
     void construct_constant_shape_of();
+    void check_generic() const;
+    // Evaluates every op whose inputs are all constant with m_evaluator
+    bool fold_generic(const std::shared_ptr<ngraph::Function>& f);
 
     ngraph::BuildNodeExecutorMap m_cfmap;
+    ConstantEvaluator m_evaluator;
+    bool m_enable_generic = false;
+    size_t m_max_folded_bytes;
+    size_t m_folded_op_count = 0;
+    size_t m_folded_bytes = 0;
 };
@@ -26,6 +26,12 @@ namespace ngraph
     }
 }
 
+/// \brief Merges nodes that compute the same values.
+///
+/// Nodes are compared with Node::is_structurally_equal, so every op that describes its
+/// attributes through Node::has_same_attributes takes part. Constants are merged when their
+/// contents are equal. Backend ops may instead be compared by a handler registered for their
+/// type.
 class ngraph::pass::CommonSubexpressionElimination : public FunctionPass
 {
 public:
@@ -33,6 +39,7 @@ public:
         : FunctionPass()
     {
         set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+        set_property(PassProperty::THREAD_SAFE, true);
     }
 
     CommonSubexpressionElimination(
@@ -43,6 +50,7 @@ public:
         , m_backend_cse_handlers(backend_cse_handlers)
     {
         set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+        set_property(PassProperty::THREAD_SAFE, true);
     }
 
     std::unordered_map<std::type_index,
@@ -15,13 +15,17 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
 #include <regex>
+#include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/label.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -57,18 +61,108 @@ using namespace ngraph;
 // b) you are modifying nodes after the current node in the topological order
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other fusion
+//
+// A node is only offered to the matchers whose pattern root can match its type. The matcher
+// compares the exact type of non-pattern ops, so a pattern rooted at such an op, possibly
+// wrapped in Labels, is indexed by that type. Patterns rooted at Skip, Any, AnyOf or a Label
+// without a sub-pattern may match any node and are offered every node. Candidates are tried
+// in registration order, so the outcome is the same as trying every matcher.
+
+// Returns the type of the nodes the pattern can be rooted at, or nullptr if there is no
+// single such type
+static const type_info* get_pattern_root_type(shared_ptr<Node> pattern)
+{
+    // A Label matches the nodes matched by its sub-pattern that also satisfy its predicate
+    while (auto label = dynamic_pointer_cast<pattern::op::Label>(pattern))
+    {
+        if (label->get_input_size() != 1)
+        {
+            return nullptr;
+        }
+        pattern = label->get_argument(0);
+    }
+    if (dynamic_pointer_cast<pattern::op::Pattern>(pattern))
+    {
+        return nullptr;
+    }
+    return &typeid(*pattern);
+}
+
+namespace
+{
+    // Indices of the matchers to try on each node type, in registration order
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const vector<shared_ptr<Node>>& patterns)
+        {
+            for (size_t i = 0; i < patterns.size(); i++)
+            {
+                if (auto type = get_pattern_root_type(patterns[i]))
+                {
+                    m_typed_matchers[type_index(*type)].push_back(i);
+                }
+                else
+                {
+                    m_untyped_matchers.push_back(i);
+                }
+            }
+        }
+
+        const vector<size_t>& get_candidates(const Node& node)
+        {
+            type_index node_type(typeid(node));
+            auto candidates_it = m_candidates.find(node_type);
+            if (candidates_it == m_candidates.end())
+            {
+                vector<size_t> candidates;
+                auto typed_it = m_typed_matchers.find(node_type);
+                if (typed_it == m_typed_matchers.end())
+                {
+                    candidates = m_untyped_matchers;
+                }
+                else
+                {
+                    merge(typed_it->second.begin(),
+                          typed_it->second.end(),
+                          m_untyped_matchers.begin(),
+                          m_untyped_matchers.end(),
+                          back_inserter(candidates));
+                }
+                candidates_it = m_candidates.insert({node_type, move(candidates)}).first;
+            }
+            return candidates_it->second;
+        }
+
+    private:
+        unordered_map<type_index, vector<size_t>> m_typed_matchers;
+        vector<size_t> m_untyped_matchers;
+        unordered_map<type_index, vector<size_t>> m_candidates;
+    };
+}
+
+// This check is very expensive and is only needed for experimental features, so we will hide
+// it behind an environment variable for now. TODO: Find a less expensive way to handle this.
+static bool rerun_dynamic_check()
+{
+    static bool s_rerun_dynamic_check =
+        (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
+    return s_rerun_dynamic_check;
+}
+
+bool pass::GraphRewrite::get_default_worklist_mode()
+{
+    return std::getenv("NGRAPH_GRAPH_REWRITE_WORKLIST") != nullptr;
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     bool rewritten = false;
     const size_t NUM_TRIES = 10;
     size_t tries = NUM_TRIES;
+    bool transformed = false;
     vector<MatchClosure> original_matchers{m_matchers};
-    // This check is very expensive and is only needed for experimental features, so we will hide
-    // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
-    static bool s_rerun_dynamic_check =
-        (std::getenv("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK") != nullptr);
-    bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+    bool is_dyn_func = rerun_dynamic_check() && f->is_dynamic();
     do
     {
         rewritten = false;
@@ -76,44 +170,207 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+
+        if (m_worklist_mode)
+        {
+            // Bounded like the sweep rounds, each of which rewrites at most once per node
+            size_t max_rewrites = NUM_TRIES * f->get_ops().size();
+            rewritten = run_worklist(f, matchers_to_run, is_dyn_func, max_rewrites);
+            transformed = transformed || rewritten;
+            continue;
+        }
+
+        vector<shared_ptr<Node>> patterns;
+        for (auto& closure : matchers_to_run)
+        {
+            patterns.push_back(closure.matcher->get_pattern());
+        }
+        MatcherIndex index(patterns);
+
         for (auto node : f->get_ordered_ops())
         {
-            for (auto& closure : matchers_to_run)
+            if (apply_matchers(node, index.get_candidates(*node), matchers_to_run, f, is_dyn_func))
             {
-                if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+                rewritten = true;
+            }
+        }
+    } while (rewritten && m_matchers.size() > 0 && tries--);
+
+    m_matchers.assign(original_matchers.begin(), original_matchers.end());
+    if (m_worklist_mode)
+    {
+        return transformed;
+    }
+    return (NUM_TRIES - tries) > 1; //this means a graph was transformed
+}
+
+bool pass::GraphRewrite::apply_matchers(const shared_ptr<Node>& node,
+                                        const vector<size_t>& candidates,
+                                        vector<MatchClosure>& matchers,
+                                        const shared_ptr<Function>& f,
+                                        bool& is_dyn_func)
+{
+    for (size_t matcher_index : candidates)
+    {
+        auto& closure = matchers[matcher_index];
+        if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+        {
+            NGRAPH_DEBUG << "matcher callback requires static shape but the "
+                            "function is dynamic, skipping this "
+                            "optimization till the shapes are fully "
+                            "materialized";
+            continue;
+        }
+        NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
+                     << closure.matcher->get_pattern()->get_name() << ") on "
+                     << node->get_name();
+        if (closure.matcher->match(node))
+        {
+            NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
+                         << " matched " << node->get_name();
+            if (closure.callback(*closure.matcher.get()))
+            {
+                m_num_matchers_fired++;
+                // If call back may change function's is_dynamic state, we need to
+                // update the cached value.
+                if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
                 {
-                    NGRAPH_DEBUG << "matcher callback requires static shape but the "
-                                    "function is dynamic, skipping this "
-                                    "optimization till the shapes are fully "
-                                    "materialized";
-                    continue;
+                    is_dyn_func = rerun_dynamic_check() && f->is_dynamic();
                 }
-                NGRAPH_DEBUG << "Running matcher " << closure.matcher->get_name() << "("
-                             << closure.matcher->get_pattern()->get_name() << ") on "
-                             << node->get_name();
-                if (closure.matcher->match(node))
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Worklist mode:
+// The worklist starts with every node in topological order. Once a callback rewrites the
+// graph at a node, the nodes it created are found by walking up from the inputs of the node's
+// former users, and of the node itself if it is still in use, until reaching nodes that were
+// already known. The new nodes, the producers feeding them and the former users are queued
+// again, as are the producers the former users now read from, so the rewrite converges
+// without re-sweeping the graph. Queued nodes that were
+// replaced in the meantime, i.e. that no longer have users, are dropped.
+bool pass::GraphRewrite::run_worklist(const shared_ptr<Function>& f,
+                                      vector<MatchClosure>& matchers,
+                                      bool& is_dyn_func,
+                                      size_t max_rewrites)
+{
+    vector<shared_ptr<Node>> patterns;
+    for (auto& closure : matchers)
+    {
+        patterns.push_back(closure.matcher->get_pattern());
+    }
+    MatcherIndex index(patterns);
+
+    deque<shared_ptr<Node>> worklist;
+    unordered_set<Node*> queued;
+    unordered_set<Node*> known;
+    auto enqueue = [&worklist, &queued](const shared_ptr<Node>& node) {
+        if (queued.insert(node.get()).second)
+        {
+            worklist.push_back(node);
+        }
+    };
+    for (auto node : f->get_ordered_ops())
+    {
+        known.insert(node.get());
+        enqueue(node);
+    }
+
+    bool rewritten = false;
+    size_t num_rewrites = 0;
+    while (!worklist.empty())
+    {
+        shared_ptr<Node> node = worklist.front();
+        worklist.pop_front();
+        queued.erase(node.get());
+
+        NodeVector users = node->get_users();
+        if (users.empty() && !node->is_output() && !node->is_parameter())
+        {
+            continue;
+        }
+        if (num_rewrites == max_rewrites)
+        {
+            // Callbacks that keep undoing each other would otherwise never converge
+            NGRAPH_WARN << "GraphRewrite stopped after " << num_rewrites
+                        << " rewrites with " << worklist.size() + 1 << " nodes still queued";
+            break;
+        }
+        if (!apply_matchers(node, index.get_candidates(*node), matchers, f, is_dyn_func))
+        {
+            continue;
+        }
+        rewritten = true;
+        num_rewrites++;
+
+        NodeVector roots;
+        for (auto& user : users)
+        {
+            for (auto& argument : user->get_arguments())
+            {
+                roots.push_back(argument);
+            }
+        }
+        if (!node->get_users().empty())
+        {
+            for (auto& argument : node->get_arguments())
+            {
+                roots.push_back(argument);
+            }
+        }
+
+        // Post-order walk over the new nodes so that they are queued after their arguments
+        NodeVector new_nodes;
+        NodeVector producers;
+        vector<pair<shared_ptr<Node>, size_t>> stack;
+        for (auto& root : roots)
+        {
+            if (!known.insert(root.get()).second)
+            {
+                producers.push_back(root);
+                continue;
+            }
+            stack.push_back({root, 0});
+            while (!stack.empty())
+            {
+                auto& top = stack.back();
+                if (top.second < top.first->get_input_size())
                 {
-                    NGRAPH_DEBUG << "Matcher " << closure.matcher << closure.matcher->get_name()
-                                 << " matched " << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
+                    shared_ptr<Node> argument = top.first->get_argument(top.second++);
+                    if (known.insert(argument.get()).second)
                     {
-                        rewritten = true;
-                        // If call back may change function's is_dynamic state, we need to
-                        // update the cached value.
-                        if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
-                        {
-                            is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
-                        }
-                        break;
+                        stack.push_back({argument, 0});
+                    }
+                    else
+                    {
+                        producers.push_back(argument);
                     }
                 }
+                else
+                {
+                    new_nodes.push_back(top.first);
+                    stack.pop_back();
+                }
             }
         }
 
-    } while (rewritten && m_matchers.size() > 0 && tries--);
-
-    m_matchers.assign(original_matchers.begin(), original_matchers.end());
-    return (NUM_TRIES - tries) > 1; //this means a graph was transformed
+        for (auto& producer : producers)
+        {
+            enqueue(producer);
+        }
+        for (auto& new_node : new_nodes)
+        {
+            enqueue(new_node);
+        }
+        for (auto& user : users)
+        {
+            enqueue(user);
+        }
+    }
+    return rewritten;
 }
 
 static vector<regex> initialize_fusion_regexes()
@@ -228,6 +485,7 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
                                  << node->get_name();
                     if (closure.callback(*closure.matcher.get()))
                     {
+                        m_num_matchers_fired++;
                         // If call back may change function's is_dynamic state, we need to
                         // update the cached value.
                         if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
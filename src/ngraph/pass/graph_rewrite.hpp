@@ -45,12 +45,19 @@ namespace ngraph
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+///
+/// By default the pass sweeps the graph once per round. In worklist mode, enabled with
+/// \sa set_worklist_mode or the environment variable NGRAPH_GRAPH_REWRITE_WORKLIST, only the
+/// nodes around a successful rewrite are matched again, until no matcher applies anywhere.
+/// Both modes run at most 10 rounds, and a worklist round stops with a warning after as many
+/// rewrites as ten sweeps over the graph could apply.
 
 class ngraph::pass::GraphRewrite : public FunctionPass
 {
 public:
     GraphRewrite()
         : FunctionPass()
+        , m_worklist_mode(get_default_worklist_mode())
     {
         // Being explicit:
         // Setting REQUIRE_STATIC_SHAPE to false because we will check if each
@@ -68,6 +75,10 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    bool get_worklist_mode() const { return m_worklist_mode; }
+    void set_worklist_mode(bool worklist_mode) { m_worklist_mode = worklist_mode; }
+    /// \brief Number of matcher callbacks that rewrote the graph since the pass was created
+    size_t get_num_matchers_fired() const { return m_num_matchers_fired; }
 protected:
     bool is_enabled(const std::shared_ptr<pattern::Matcher>& m) const;
 
@@ -78,7 +89,23 @@ private:
         ngraph::graph_rewrite_callback callback;
         PassPropertyMask property;
     };
+
+    static bool get_default_worklist_mode();
+    /// \brief Tries the candidate matchers on node until a callback rewrites the graph.
+    /// \returns true if a callback rewrote the graph
+    bool apply_matchers(const std::shared_ptr<Node>& node,
+                        const std::vector<size_t>& candidates,
+                        std::vector<MatchClosure>& matchers,
+                        const std::shared_ptr<Function>& f,
+                        bool& is_dyn_func);
+    bool run_worklist(const std::shared_ptr<Function>& f,
+                      std::vector<MatchClosure>& matchers,
+                      bool& is_dyn_func,
+                      size_t max_rewrites);
+
     std::vector<MatchClosure> m_matchers;
+    bool m_worklist_mode;
+    size_t m_num_matchers_fired = 0;
 };
 
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
@@ -104,8 +131,11 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Number of matcher callbacks that rewrote the graph since the pass was created
+    size_t get_num_matchers_fired() const { return m_num_matchers_fired; }
 private:
     size_t m_num_iters;
+    size_t m_num_matchers_fired = 0;
 
     struct MatchClosure
     {
@@ -30,5 +30,6 @@ namespace ngraph
 class ngraph::pass::Liveness : public FunctionPass
 {
 public:
+    Liveness() { set_property(PassProperty::THREAD_SAFE, true); }
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 };
@@ -15,26 +15,87 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
 #ifdef _WIN32
 #else
 #include <cxxabi.h>
+#include <sys/resource.h>
 #endif
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/event_tracing.hpp"
+#endif
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/op_scheduler.hpp"
 #include "ngraph/util.hpp"
+#ifdef NGRAPH_JSON_ENABLE
+#include "nlohmann/json.hpp"
+#endif
 
 using namespace std;
 using namespace ngraph;
 
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled != nullptr)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+static int64_t get_peak_rss_bytes()
+{
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    // Linux reports kilobytes
+    return static_cast<int64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+static size_t get_matchers_fired(const shared_ptr<pass::PassBase>& pass)
+{
+    if (auto graph_rewrite = dynamic_pointer_cast<pass::GraphRewrite>(pass))
+    {
+        return graph_rewrite->get_num_matchers_fired();
+    }
+    if (auto graph_rewrite = dynamic_pointer_cast<pass::RecurrentGraphRewrite>(pass))
+    {
+        return graph_rewrite->get_num_matchers_fired();
+    }
+    return 0;
+}
+
+static atomic<size_t> s_run_count{0};
+
 pass::Manager::Manager()
 {
     static const auto nevt = std::getenv("NGRAPH_ENABLE_VISUALIZE_TRACING");
@@ -47,6 +108,15 @@ pass::Manager::Manager()
     {
         m_serialize = true;
     }
+    static const auto npt = std::getenv("NGRAPH_PASS_THREADS");
+    if (npt)
+    {
+        m_num_threads = max<size_t>(1, strtoul(npt, nullptr, 10));
+    }
+    if (std::getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr)
+    {
+        m_profile = true;
+    }
 }
 
 pass::Manager::~Manager()
@@ -57,9 +127,19 @@ void pass::Manager::initialize_default_passes()
 {
 }
 
+size_t pass::Manager::get_run_count()
+{
+    return s_run_count;
+}
+
 void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
 {
+    s_run_count++;
     bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    bool collect_profile = m_profile || profile_enabled;
+#ifdef NGRAPH_JSON_ENABLE
+    collect_profile = collect_profile || Event::is_tracing_enabled();
+#endif
 
     vector<std::pair<shared_ptr<Function>, bool>> fs;
     if (transitive)
@@ -83,13 +163,46 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
     }
     get_state().set_functions(tfs);
 
+    auto count_nodes = [&fs]() {
+        size_t count = 0;
+        for (auto& f_pair : fs)
+        {
+            count += f_pair.first->get_ops().size();
+        }
+        return count;
+    };
+
     size_t index = 0;
     stopwatch pass_timer;
+    stopwatch validate_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    // Pool for running thread-safe FunctionPasses over several functions, created on first use
+    unique_ptr<runtime::OpScheduler> scheduler;
+    vector<size_t> function_times;
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        if (m_is_cancelled && m_is_cancelled())
+        {
+            throw ngraph_error("Pass pipeline cancelled");
+        }
+        PassProfile profile;
+#ifdef NGRAPH_JSON_ENABLE
+        unique_ptr<Event> event;
+#endif
+        if (collect_profile)
+        {
+            profile.m_name = get_pass_name(*pass);
+            profile.m_nodes_before = count_nodes();
+            profile.m_matchers_fired = get_matchers_fired(pass);
+            profile.m_peak_rss_delta_bytes = get_peak_rss_bytes();
+#ifdef NGRAPH_JSON_ENABLE
+            event.reset(new Event(profile.m_name, "Pass", ""));
+#endif
+        }
         pass_timer.start();
+        function_times.clear();
+        size_t pass_threads = 1;
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
         auto function_pass = dynamic_pointer_cast<FunctionPass>(pass);
@@ -105,8 +218,10 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
         }
         else if (function_pass)
         {
-            for (auto f_pair : fs)
-            {
+            auto run_function_pass = [&](size_t i) {
+                stopwatch function_timer;
+                function_timer.start();
+                auto f_pair = fs[i];
                 shared_ptr<Function> f = f_pair.first;
                 // This checks is to skip the graph optimization when the graph pass relies on static shape
                 // but the function state is dynamic.
@@ -114,7 +229,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
                 if (function_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) &&
                     f_pair.second)
                 {
-                    continue;
+                    return;
                 }
                 bool function_modified = function_pass->run_on_function(f);
                 // If the pass may change the function's is_dynamic property, we need to
@@ -124,6 +239,28 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
                 {
                     f_pair.second = f->is_dynamic();
                 }
+                function_timer.stop();
+                function_times[i] = function_timer.get_milliseconds();
+            };
+            function_times.assign(fs.size(), 0);
+            if (function_pass->get_property(PassProperty::THREAD_SAFE) && fs.size() > 1 &&
+                m_num_threads > 1)
+            {
+                if (!scheduler)
+                {
+                    // Functions do not depend on each other, so every function is ready at once
+                    scheduler.reset(new runtime::OpScheduler(
+                        vector<vector<size_t>>(fs.size()), min(m_num_threads, fs.size())));
+                }
+                scheduler->run(run_function_pass);
+                pass_threads = scheduler->get_num_threads();
+            }
+            else
+            {
+                for (size_t i = 0; i < fs.size(); ++i)
+                {
+                    run_function_pass(i);
+                }
             }
         }
         else if (node_pass)
@@ -147,17 +284,21 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
                 {
                     continue;
                 }
-                bool function_modified = call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                auto ordered_ops = f->get_ordered_ops();
+                bool function_modified = call_graph_pass->run_on_call_graph(
+                    list<shared_ptr<Node>>(ordered_ops.begin(), ordered_ops.end()));
                 f_pair.second = (function_modified == true) ? f->is_dynamic() : f_pair.second;
             }
         }
 
         // Better to do this in node replacement but this will do for now
+        validate_timer.start();
         for (auto f_pair : fs)
         {
             shared_ptr<Function> f = f_pair.first;
             f->validate_nodes_and_infer_types();
         }
+        validate_timer.stop();
 
         if (m_visualize || m_serialize)
         {
@@ -183,15 +324,44 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
         }
         index++;
         pass_timer.stop();
-        if (profile_enabled)
+        if (collect_profile)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+            profile.m_wall_microseconds = pass_timer.get_microseconds();
+            profile.m_validate_microseconds = validate_timer.get_microseconds();
+            profile.m_nodes_after = count_nodes();
+            profile.m_matchers_fired = get_matchers_fired(pass) - profile.m_matchers_fired;
+            profile.m_peak_rss_delta_bytes =
+                get_peak_rss_bytes() - profile.m_peak_rss_delta_bytes;
+#ifdef NGRAPH_JSON_ENABLE
+            event->Stop();
+            stringstream args;
+            args << "nodes_before=" << profile.m_nodes_before
+                 << " nodes_after=" << profile.m_nodes_after
+                 << " matchers_fired=" << profile.m_matchers_fired
+                 << " peak_rss_delta=" << profile.m_peak_rss_delta_bytes;
+            event->set_args(args.str());
+            Event::write_trace(*event);
 #endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            m_profile_results.push_back(profile);
+        }
+        if (profile_enabled)
+        {
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << profile.m_name
+                 << " [validate " << validate_timer.get_milliseconds() << "ms";
+            if (pass_threads > 1)
+            {
+                cout << ", " << pass_threads << " threads";
+            }
+            cout << "]\n";
+            // Breakdown over the functions of the module
+            if (function_times.size() > 1)
+            {
+                for (size_t i = 0; i < fs.size(); ++i)
+                {
+                    cout << setw(14) << function_times[i] << "ms " << fs[i].first->get_name()
+                         << "\n";
+                }
+            }
         }
     }
     if (profile_enabled)
@@ -204,3 +374,23 @@ pass::ManagerState& pass::Manager::get_state()
 {
     return m_state;
 }
+
+string pass::Manager::get_profile_json() const
+{
+#ifndef NGRAPH_JSON_ENABLE
+    throw ngraph_error("pass::Manager::get_profile_json requires NGRAPH_JSON_ENABLE");
+#else
+    nlohmann::json profiles = nlohmann::json::array();
+    for (const PassProfile& profile : m_profile_results)
+    {
+        profiles.push_back({{"name", profile.m_name},
+                            {"wall_us", profile.m_wall_microseconds},
+                            {"validate_us", profile.m_validate_microseconds},
+                            {"nodes_before", profile.m_nodes_before},
+                            {"nodes_after", profile.m_nodes_after},
+                            {"matchers_fired", profile.m_matchers_fired},
+                            {"peak_rss_delta_bytes", profile.m_peak_rss_delta_bytes}});
+    }
+    return profiles.dump(4);
+#endif
+}
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -31,9 +34,26 @@ namespace ngraph
     {
         class Manager;
         class ManagerState;
+        struct PassProfile;
     }
 }
 
+/// \brief Measurements for one run of a registered pass, collected by pass::Manager when
+///        profiling is enabled
+struct ngraph::pass::PassProfile
+{
+    std::string m_name;
+    size_t m_wall_microseconds = 0;
+    size_t m_validate_microseconds = 0;
+    /// Total op count over all functions before and after the pass ran
+    size_t m_nodes_before = 0;
+    size_t m_nodes_after = 0;
+    /// Matcher callbacks that rewrote the graph, for GraphRewrite based passes
+    size_t m_matchers_fired = 0;
+    /// Growth of the process peak resident set size while the pass ran
+    int64_t m_peak_rss_delta_bytes = 0;
+};
+
 class ngraph::pass::Manager
 {
 public:
@@ -71,6 +91,33 @@ public:
     void set_pass_config(const PassConfig& pass_config) { m_pass_config = pass_config; }
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    /// \brief Sets the number of threads on which FunctionPasses with the THREAD_SAFE property
+    ///        run over the functions of a module. The default is 1, or the value of the
+    ///        environment variable NGRAPH_PASS_THREADS.
+    void set_num_threads(size_t num_threads) { m_num_threads = num_threads; }
+    size_t get_num_threads() const { return m_num_threads; }
+    /// \brief Collect a PassProfile for every pass run by run_passes. Also enabled by the
+    ///        environment variable NGRAPH_PROFILE_PASS_ENABLE, which additionally prints the
+    ///        timings to stdout. When event tracing is enabled every pass is written as a
+    ///        Chrome trace event.
+    void set_profiling(bool enable) { m_profile = enable; }
+    bool get_profiling() const { return m_profile; }
+    /// \brief Profiles of the passes run so far, in the order they ran
+    const std::vector<PassProfile>& get_profile() const { return m_profile_results; }
+    /// \brief get_profile() as a JSON array. Throws when ngraph is built without
+    ///        NGRAPH_JSON_ENABLE.
+    std::string get_profile_json() const;
+    /// \brief Checked before every pass. Once it returns true, run_passes throws ngraph_error
+    ///        instead of running the remaining passes, e.g. to abandon a background compile
+    ///        whose result is no longer needed.
+    void set_cancellation_check(const std::function<bool()>& is_cancelled)
+    {
+        m_is_cancelled = is_cancelled;
+    }
+    /// \brief Number of run_passes calls in this process, e.g. to check that loading a saved
+    ///        executable does not compile it again
+    static size_t get_run_count();
+
 private:
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
@@ -78,4 +125,8 @@ private:
     PassConfig m_pass_config;
     bool m_visualize = false;
     bool m_serialize = false;
+    size_t m_num_threads = 1;
+    bool m_profile = false;
+    std::vector<PassProfile> m_profile_results;
+    std::function<bool()> m_is_cancelled;
 };
@@ -14,8 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
@@ -30,19 +32,30 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 bool interval_planning)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_interval_planning(interval_planning ||
+                          std::getenv("NGRAPH_INTERVAL_MEMORY_PLANNER") != nullptr)
 {
     if (m_alignment == 0)
     {
         throw invalid_argument("Memory alignment must be > 0");
     }
+    set_property(PassProperty::THREAD_SAFE, true);
 }
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    // Without sharing every tensor gets its own buffer, so there is nothing to plan
+    bool interval_planning = m_interval_planning && !m_disable_memory_sharing;
+    IntervalMemoryPlanner planner(m_alignment);
+    // Planner buffer of each tensor, in place outputs share the buffer of their input
+    unordered_map<descriptor::Tensor*, size_t> tensor_buffers;
+    size_t step = 0;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -84,6 +97,16 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
+            if (interval_planning)
+            {
+                auto it = in_place_outputs.count(tensor)
+                              ? tensor_buffers.find(in_place_outputs.at(tensor))
+                              : tensor_buffers.end();
+                tensor_buffers[tensor] = it != tensor_buffers.end()
+                                             ? it->second
+                                             : planner.add_buffer(tensor->size(), step);
+                continue;
+            }
             size_t offset = in_place_outputs.count(tensor)
                                 ? in_place_outputs.at(tensor)->get_pool_offset()
                                 : mm.allocate(tensor->size());
@@ -92,16 +115,45 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 
         if (!m_disable_memory_sharing)
         {
-            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
             {
-                if (reused_inputs.count(tensor) == 0)
+                if (reused_inputs.count(tensor) != 0)
+                {
+                    continue;
+                }
+                if (interval_planning)
+                {
+                    auto it = tensor_buffers.find(tensor);
+                    if (it != tensor_buffers.end())
+                    {
+                        planner.release(it->second, step);
+                    }
+                }
+                else
                 {
                     mm.free(tensor->get_pool_offset());
                 }
             }
         }
+        step++;
+    }
+
+    if (interval_planning)
+    {
+        planner.plan();
+        for (auto& tensor_buffer : tensor_buffers)
+        {
+            tensor_buffer.first->set_pool_offset(planner.get_offset(tensor_buffer.second));
+        }
+        NGRAPH_DEBUG << "MemoryLayout: " << function->get_name() << " temporary pool "
+                     << planner.max_allocated() << " bytes, lower bound "
+                     << planner.lower_bound() << " bytes";
+        function->set_temporary_pool_size(planner.max_allocated());
+    }
+    else
+    {
+        function->set_temporary_pool_size(mm.max_allocated());
     }
-    function->set_temporary_pool_size(mm.max_allocated());
 
     return false;
 }
@@ -291,3 +343,163 @@ size_t pass::MemoryManager::align(size_t size, size_t alignment)
     }
     return size;
 }
+
+static const size_t s_live_until_end = numeric_limits<size_t>::max();
+
+pass::IntervalMemoryPlanner::IntervalMemoryPlanner(size_t alignment)
+    : m_alignment{alignment}
+    , m_max_allocated{0}
+    , m_lower_bound{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+}
+
+size_t pass::IntervalMemoryPlanner::add_buffer(size_t size, size_t first_use)
+{
+    m_buffers.push_back(
+        {MemoryManager::align(size, m_alignment), first_use, s_live_until_end, 0});
+    return m_buffers.size() - 1;
+}
+
+void pass::IntervalMemoryPlanner::release(size_t id, size_t last_use)
+{
+    Buffer& buffer = m_buffers.at(id);
+    last_use = max(last_use, buffer.m_first_use);
+    if (buffer.m_last_use == s_live_until_end || buffer.m_last_use < last_use)
+    {
+        buffer.m_last_use = last_use;
+    }
+}
+
+void pass::IntervalMemoryPlanner::plan()
+{
+    m_max_allocated = 0;
+    m_lower_bound = 0;
+    if (m_buffers.empty())
+    {
+        return;
+    }
+
+    size_t num_steps = 0;
+    for (const Buffer& buffer : m_buffers)
+    {
+        num_steps = max(num_steps, buffer.m_first_use + 1);
+        if (buffer.m_last_use != s_live_until_end)
+        {
+            num_steps = max(num_steps, buffer.m_last_use + 1);
+        }
+    }
+
+    // Bytes live at each step
+    vector<size_t> allocated(num_steps, 0);
+    vector<size_t> released(num_steps, 0);
+    for (Buffer& buffer : m_buffers)
+    {
+        if (buffer.m_last_use == s_live_until_end)
+        {
+            buffer.m_last_use = num_steps - 1;
+        }
+        allocated[buffer.m_first_use] += buffer.m_size;
+        released[buffer.m_last_use] += buffer.m_size;
+    }
+    vector<size_t> breadth(num_steps);
+    size_t live = 0;
+    for (size_t step = 0; step < num_steps; ++step)
+    {
+        live += allocated[step];
+        breadth[step] = live;
+        m_lower_bound = max(m_lower_bound, live);
+        live -= released[step];
+    }
+
+    // Sparse table for the widest step within a live range
+    vector<vector<size_t>> widest{breadth};
+    for (size_t width = 2; width <= num_steps; width *= 2)
+    {
+        const vector<size_t>& prev = widest.back();
+        vector<size_t> level(num_steps - width + 1);
+        for (size_t i = 0; i < level.size(); ++i)
+        {
+            level[i] = max(prev[i], prev[i + width / 2]);
+        }
+        widest.push_back(move(level));
+    }
+    auto widest_step = [&widest](size_t first, size_t last) {
+        size_t level = 0;
+        while ((size_t(2) << level) <= last - first + 1)
+        {
+            level++;
+        }
+        return max(widest[level][first], widest[level][last + 1 - (size_t(1) << level)]);
+    };
+
+    // A buffer is placed when its widest step is packed, largest and longest lived first
+    vector<size_t> order(m_buffers.size());
+    vector<size_t> priority(m_buffers.size());
+    for (size_t id = 0; id < m_buffers.size(); ++id)
+    {
+        order[id] = id;
+        priority[id] = widest_step(m_buffers[id].m_first_use, m_buffers[id].m_last_use);
+    }
+    sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        const Buffer& buffer_a = m_buffers[a];
+        const Buffer& buffer_b = m_buffers[b];
+        if (priority[a] != priority[b])
+        {
+            return priority[a] > priority[b];
+        }
+        if (buffer_a.m_size != buffer_b.m_size)
+        {
+            return buffer_a.m_size > buffer_b.m_size;
+        }
+        size_t life_a = buffer_a.m_last_use - buffer_a.m_first_use;
+        size_t life_b = buffer_b.m_last_use - buffer_b.m_first_use;
+        if (life_a != life_b)
+        {
+            return life_a > life_b;
+        }
+        return a < b;
+    });
+
+    vector<const Buffer*> placed;
+    vector<const Buffer*> overlapping;
+    for (size_t id : order)
+    {
+        Buffer& buffer = m_buffers[id];
+        overlapping.clear();
+        for (const Buffer* other : placed)
+        {
+            if (other->m_first_use <= buffer.m_last_use && buffer.m_first_use <= other->m_last_use)
+            {
+                overlapping.push_back(other);
+            }
+        }
+        sort(overlapping.begin(), overlapping.end(), [](const Buffer* a, const Buffer* b) {
+            return a->m_offset < b->m_offset;
+        });
+
+        // Tightest gap between buffers that are live at the same time, or the top of the pool
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t best_offset = 0;
+        size_t end = 0;
+        for (const Buffer* other : overlapping)
+        {
+            if (other->m_offset > end)
+            {
+                size_t gap = other->m_offset - end;
+                if (gap >= buffer.m_size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = end;
+                }
+            }
+            end = max(end, other->m_offset + other->m_size);
+        }
+        buffer.m_offset = best_gap == numeric_limits<size_t>::max() ? end : best_offset;
+        m_max_allocated = max(m_max_allocated, buffer.m_offset + buffer.m_size);
+        placed.push_back(&buffer);
+    }
+}
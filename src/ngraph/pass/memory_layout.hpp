@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -29,18 +30,25 @@ namespace ngraph
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class IntervalMemoryPlanner;
     }
 }
 
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \param interval_planning Place the temporaries with IntervalMemoryPlanner instead of
+    ///        allocating them in program order. Also enabled by the environment variable
+    ///        NGRAPH_INTERVAL_MEMORY_PLANNER.
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool interval_planning = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_interval_planning;
 };
 
 class ngraph::pass::MemoryManager
@@ -95,3 +103,43 @@ private:
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+/// \brief Offline memory planner. All buffers and their live ranges, in program steps, are
+///        registered first and then placed at once with the greedy-by-breadth heuristic: the
+///        steps with the most live bytes are packed first, largest buffers first, each buffer
+///        going into the tightest gap left by the buffers already placed that overlap it in
+///        time.
+class ngraph::pass::IntervalMemoryPlanner
+{
+public:
+    IntervalMemoryPlanner(size_t alignment = 1);
+
+    /// \brief Adds a buffer that is live from step first_use until it is released.
+    /// \returns the id of the buffer
+    size_t add_buffer(size_t size, size_t first_use);
+    /// \brief Marks the last step at which the buffer is live. Buffers that are never released
+    ///        stay live until the last step seen by the planner.
+    void release(size_t id, size_t last_use);
+
+    /// \brief Assigns an offset to every buffer.
+    void plan();
+
+    size_t get_offset(size_t id) const { return m_buffers.at(id).m_offset; }
+    /// \brief Size of the pool needed for the planned offsets
+    size_t max_allocated() const { return m_max_allocated; }
+    /// \brief Largest number of bytes live at any one step. No placement can need less.
+    size_t lower_bound() const { return m_lower_bound; }
+private:
+    struct Buffer
+    {
+        size_t m_size;
+        size_t m_first_use;
+        size_t m_last_use;
+        size_t m_offset;
+    };
+
+    std::vector<Buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_max_allocated;
+    size_t m_lower_bound;
+};
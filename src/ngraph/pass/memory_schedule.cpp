@@ -0,0 +1,230 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct ScheduleGraph
+    {
+        // Bytes of the pool tensors each op produces
+        vector<int64_t> output_bytes;
+        // Pool tensors each op reads
+        vector<vector<size_t>> reads;
+        vector<int64_t> tensor_bytes;
+        vector<vector<size_t>> tensor_readers;
+        vector<vector<size_t>> successors;
+        vector<size_t> predecessor_count;
+    };
+}
+
+static ScheduleGraph build_schedule_graph(const vector<shared_ptr<Node>>& ops)
+{
+    ScheduleGraph graph;
+    size_t op_count = ops.size();
+    graph.output_bytes.assign(op_count, 0);
+    graph.reads.resize(op_count);
+    graph.successors.resize(op_count);
+    graph.predecessor_count.assign(op_count, 0);
+
+    unordered_map<Node*, size_t> op_index;
+    unordered_map<descriptor::Tensor*, size_t> tensor_index;
+    for (size_t i = 0; i < op_count; ++i)
+    {
+        Node* node = ops[i].get();
+        op_index[node] = i;
+
+        unordered_set<size_t> predecessors;
+        for (auto& input : node->inputs())
+        {
+            predecessors.insert(op_index.at(input.get_source_output().get_node()));
+            auto tensor = tensor_index.find(&input.get_tensor());
+            if (tensor != tensor_index.end() &&
+                find(graph.reads[i].begin(), graph.reads[i].end(), tensor->second) ==
+                    graph.reads[i].end())
+            {
+                graph.reads[i].push_back(tensor->second);
+                graph.tensor_readers[tensor->second].push_back(i);
+            }
+        }
+        for (auto& dep : node->get_control_dependencies())
+        {
+            predecessors.insert(op_index.at(dep.get()));
+        }
+        for (size_t predecessor : predecessors)
+        {
+            graph.successors[predecessor].push_back(i);
+        }
+        graph.predecessor_count[i] = predecessors.size();
+
+        // Parameters, constants and results are not allocated from the pool
+        if (node->is_parameter() || node->is_constant() || node->is_output())
+        {
+            continue;
+        }
+        for (auto& output : node->outputs())
+        {
+            descriptor::Tensor& tensor = output.get_tensor();
+            int64_t bytes = tensor.size();
+            tensor_index[&tensor] = graph.tensor_bytes.size();
+            graph.tensor_bytes.push_back(bytes);
+            graph.tensor_readers.emplace_back();
+            graph.output_bytes[i] += bytes;
+        }
+    }
+    return graph;
+}
+
+// Peak pool size when the ops run in the given order
+static int64_t estimate_peak(const ScheduleGraph& graph, const vector<size_t>& order)
+{
+    vector<size_t> unread(graph.tensor_bytes.size());
+    for (size_t tensor = 0; tensor < unread.size(); ++tensor)
+    {
+        unread[tensor] = graph.tensor_readers[tensor].size();
+    }
+    int64_t live = 0;
+    int64_t peak = 0;
+    for (size_t i : order)
+    {
+        live += graph.output_bytes[i];
+        peak = max(peak, live);
+        for (size_t tensor : graph.reads[i])
+        {
+            if (--unread[tensor] == 0)
+            {
+                live -= graph.tensor_bytes[tensor];
+            }
+        }
+    }
+    return peak;
+}
+
+static vector<size_t> schedule(const ScheduleGraph& graph)
+{
+    size_t op_count = graph.output_bytes.size();
+    vector<size_t> unread(graph.tensor_bytes.size());
+    for (size_t tensor = 0; tensor < unread.size(); ++tensor)
+    {
+        unread[tensor] = graph.tensor_readers[tensor].size();
+    }
+    vector<size_t> pending = graph.predecessor_count;
+    vector<bool> scheduled(op_count, false);
+
+    // Growth of the pool if op i ran now
+    auto growth = [&](size_t i) {
+        int64_t bytes = graph.output_bytes[i];
+        for (size_t tensor : graph.reads[i])
+        {
+            if (unread[tensor] == 1)
+            {
+                bytes -= graph.tensor_bytes[tensor];
+            }
+        }
+        return bytes;
+    };
+
+    // Ties go to the original order
+    set<pair<int64_t, size_t>> ready;
+    vector<int64_t> ready_key(op_count, 0);
+    for (size_t i = 0; i < op_count; ++i)
+    {
+        if (pending[i] == 0)
+        {
+            ready_key[i] = growth(i);
+            ready.insert({ready_key[i], i});
+        }
+    }
+
+    vector<size_t> order;
+    order.reserve(op_count);
+    while (!ready.empty())
+    {
+        size_t i = ready.begin()->second;
+        ready.erase(ready.begin());
+        scheduled[i] = true;
+        order.push_back(i);
+
+        for (size_t tensor : graph.reads[i])
+        {
+            if (--unread[tensor] != 1)
+            {
+                continue;
+            }
+            // The remaining reader now frees the tensor, which makes it cheaper to run
+            for (size_t reader : graph.tensor_readers[tensor])
+            {
+                if (!scheduled[reader] && pending[reader] == 0)
+                {
+                    ready.erase({ready_key[reader], reader});
+                    ready_key[reader] = growth(reader);
+                    ready.insert({ready_key[reader], reader});
+                }
+            }
+        }
+        for (size_t successor : graph.successors[i])
+        {
+            if (--pending[successor] == 0)
+            {
+                ready_key[successor] = growth(successor);
+                ready.insert({ready_key[successor], successor});
+            }
+        }
+    }
+    return order;
+}
+
+bool pass::MemorySchedule::run_on_function(shared_ptr<Function> function)
+{
+    vector<shared_ptr<Node>> ops = function->get_ordered_ops();
+    ScheduleGraph graph = build_schedule_graph(ops);
+
+    vector<size_t> current_order(ops.size());
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        current_order[i] = i;
+    }
+    vector<size_t> order = schedule(graph);
+    NGRAPH_CHECK(order.size() == ops.size(), "MemorySchedule: graph has a cycle");
+
+    int64_t current_peak = estimate_peak(graph, current_order);
+    int64_t peak = estimate_peak(graph, order);
+    NGRAPH_DEBUG << "MemorySchedule: " << function->get_name() << " estimated peak "
+                 << current_peak << " -> " << peak << " bytes";
+    if (peak < current_peak)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(ops.size());
+        for (size_t i : order)
+        {
+            ordered_ops.push_back(ops[i]);
+        }
+        function->set_ordered_ops(ordered_ops);
+    }
+    return false;
+}
@@ -0,0 +1,40 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MemorySchedule;
+    }
+}
+
+/// \brief Reorders independent ops to lower the peak size of the temporary pool.
+///
+/// A list scheduler that always runs the ready op which grows the pool the least: the bytes
+/// of its outputs minus the bytes of the inputs it is the last reader of. The resulting order
+/// is stored with Function::set_ordered_ops, so it has to run right before Liveness and
+/// MemoryLayout. The order is only changed when it lowers the estimated peak.
+class ngraph::pass::MemorySchedule : public FunctionPass
+{
+public:
+    MemorySchedule() { set_property(PassProperty::THREAD_SAFE, true); }
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+};
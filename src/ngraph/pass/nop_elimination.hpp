@@ -25,7 +25,11 @@ namespace ngraph
         class NopElimination : public FunctionPass
         {
         public:
-            NopElimination() { set_property(PassProperty::REQUIRE_STATIC_SHAPE, true); }
+            NopElimination()
+            {
+                set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+                set_property(PassProperty::THREAD_SAFE, true);
+            }
             bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
         };
     }
@@ -63,7 +63,9 @@ namespace ngraph
             // Pass requires node shapes to be static
             REQUIRE_STATIC_SHAPE = 0x1,
             // Pass transformation will change the function's dynamic state
-            CHANGE_DYNAMIC_STATE = 1 << 1
+            CHANGE_DYNAMIC_STATE = 1 << 1,
+            // FunctionPass may run on different functions concurrently
+            THREAD_SAFE = 1 << 2
         };
         typedef EnumMask<PassProperty> PassPropertyMask;
         constexpr PassPropertyMask all_pass_property_off;
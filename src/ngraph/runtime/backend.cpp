@@ -14,11 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/runtime/cache/cache_backend.hpp"
+#endif
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "ngraph/util.hpp"
 
@@ -35,11 +39,23 @@ std::shared_ptr<ngraph::Node> runtime::Backend::get_backend_op(const std::string
     return dummy_node;
 }
 
+std::shared_ptr<runtime::Backend> runtime::Backend::create_uncached(const string& type)
+{
+    return BackendManager::create_backend(type);
+}
+
 std::shared_ptr<runtime::Backend> runtime::Backend::create(const string& type,
                                                            bool must_support_dynamic)
 {
     auto inner_backend = BackendManager::create_backend(type);
 
+#ifdef NGRAPH_JSON_ENABLE
+    if (const char* cache_dir = std::getenv("NGRAPH_COMPILE_CACHE_DIR"))
+    {
+        inner_backend = make_shared<runtime::cache::CacheBackend>(inner_backend, type, cache_dir);
+    }
+#endif
+
     if (!must_support_dynamic || inner_backend->supports_dynamic_tensors())
     {
         return inner_backend;
@@ -54,6 +54,13 @@ public:
     static std::shared_ptr<Backend> create(const std::string& type,
                                            bool must_support_dynamic = false);
 
+    /// \brief Create a new Backend object that is never wrapped with the compilation cache
+    ///        installed by `NGRAPH_COMPILE_CACHE_DIR`. For compiles made inside passes, which
+    ///        should neither pay for the cache key nor write cache files.
+    /// \param type The name of a registered backend, such as "CPU" or "GPU".
+    /// \returns shared_ptr to a new Backend
+    static std::shared_ptr<Backend> create_uncached(const std::string& type);
+
     /// \brief Query the list of registered devices
     /// \returns A vector of all registered devices.
     static std::vector<std::string> get_registered_devices();
@@ -122,7 +129,8 @@ public:
     /// \brief A set of properties supported by a backend
     enum class Property
     {
-        memory_attach /// New tensor can use attached memory
+        memory_attach,       /// New tensor can use attached memory
+        executable_save_load /// Executable::save output can be restored with load
     };
 
     /// \brief Test if a backend particular property is supported
@@ -0,0 +1,400 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+
+#include "ngraph/cpio.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cache/cache_backend.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Features that change the code a backend may generate for the host
+static string get_host_isa()
+{
+    string isa;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    isa += __builtin_cpu_supports("sse4.2") ? "sse4.2;" : "";
+    isa += __builtin_cpu_supports("avx") ? "avx;" : "";
+    isa += __builtin_cpu_supports("avx2") ? "avx2;" : "";
+    isa += __builtin_cpu_supports("fma") ? "fma;" : "";
+    isa += __builtin_cpu_supports("avx512f") ? "avx512f;" : "";
+#endif
+    return isa;
+}
+
+// Incremental 64 bit FNV-1a. FNV-1a is fully specified, so digests are the same for every
+// toolchain and process.
+class Digest
+{
+public:
+    void update(const void* data, size_t size)
+    {
+        auto bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            m_hash ^= bytes[i];
+            m_hash *= 0x100000001b3ULL;
+        }
+    }
+    // Fixed byte order, so the digest does not depend on the host
+    void update(uint64_t value)
+    {
+        for (size_t i = 0; i < sizeof(value); ++i)
+        {
+            unsigned char byte = static_cast<unsigned char>(value >> (8 * i));
+            update(&byte, 1);
+        }
+    }
+    // Strings are length prefixed so adjacent fields can not run into each other
+    void update(const string& s)
+    {
+        update(static_cast<uint64_t>(s.size()));
+        update(s.data(), s.size());
+    }
+    uint64_t get() const { return m_hash; }
+private:
+    uint64_t m_hash = 0xcbf29ce484222325ULL;
+};
+
+static void update(Digest& digest, const map<string, bool>& pass_map)
+{
+    digest.update(static_cast<uint64_t>(pass_map.size()));
+    for (auto& item : pass_map)
+    {
+        digest.update(item.first);
+        digest.update(static_cast<uint64_t>(item.second));
+    }
+}
+
+// Node, tensor and function names come from global counters, so the same graph built twice
+// is named differently. The graph is hashed in topological order with nodes referred to by
+// their position. The serializer only supplies the op type and attributes of each node;
+// constant values are hashed as raw bytes.
+static void update(Digest& digest, shared_ptr<Function> function)
+{
+    traverse_functions(function, [&](shared_ptr<Function> f) {
+        unordered_map<const Node*, uint64_t> node_index;
+        auto ordered_ops = f->get_ordered_ops_snapshot();
+        digest.update(static_cast<uint64_t>(ordered_ops->size()));
+        for (auto& node : *ordered_ops)
+        {
+            uint64_t index = node_index.size();
+            node_index[node.get()] = index;
+            digest.update(serialize_attributes(*node));
+            if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+            {
+                digest.update(constant->get_data_ptr(),
+                              shape_size(constant->get_shape()) *
+                                  constant->get_element_type().size());
+            }
+            digest.update(static_cast<uint64_t>(node->get_input_size()));
+            for (auto& input : node->inputs())
+            {
+                auto source = input.get_source_output();
+                digest.update(node_index.at(source.get_node()));
+                digest.update(static_cast<uint64_t>(source.get_index()));
+            }
+            // Control dependencies are held in a set ordered by address
+            vector<uint64_t> control_deps;
+            for (auto& dep : node->get_control_dependencies())
+            {
+                control_deps.push_back(node_index.at(dep.get()));
+            }
+            sort(control_deps.begin(), control_deps.end());
+            digest.update(static_cast<uint64_t>(control_deps.size()));
+            for (uint64_t dep : control_deps)
+            {
+                digest.update(dep);
+            }
+            digest.update(static_cast<uint64_t>(node->get_output_size()));
+            for (size_t i = 0; i < node->get_output_size(); ++i)
+            {
+                stringstream output;
+                output << node->get_output_element_type(i) << node->get_output_partial_shape(i);
+                digest.update(output.str());
+            }
+        }
+        digest.update(static_cast<uint64_t>(f->get_parameters().size()));
+        for (auto& parameter : f->get_parameters())
+        {
+            digest.update(node_index.at(parameter.get()));
+        }
+        digest.update(static_cast<uint64_t>(f->get_results().size()));
+        for (auto& result : f->get_results())
+        {
+            digest.update(node_index.at(result.get()));
+        }
+    });
+}
+
+runtime::cache::CacheBackend::CacheBackend(shared_ptr<runtime::Backend> wrapped_backend,
+                                           const string& backend_name,
+                                           const string& cache_directory)
+    : m_wrapped_backend(std::move(wrapped_backend))
+    , m_backend_name(backend_name)
+    , m_cache_directory(cache_directory)
+    , m_disk_cache_enabled(
+          m_wrapped_backend->is_supported_property(Property::executable_save_load))
+{
+    if (m_disk_cache_enabled)
+    {
+        file_util::make_directory(m_cache_directory);
+    }
+    else
+    {
+        NGRAPH_INFO << "Backend " << m_backend_name
+                    << " can not save executables, compiles are cached in memory only";
+    }
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::cache::CacheBackend::create_tensor(const element::Type& type, const Shape& shape)
+{
+    return m_wrapped_backend->create_tensor(type, shape);
+}
+
+shared_ptr<runtime::Tensor> runtime::cache::CacheBackend::create_tensor(
+    const element::Type& type, const Shape& shape, void* memory_pointer)
+{
+    return m_wrapped_backend->create_tensor(type, shape, memory_pointer);
+}
+
+shared_ptr<runtime::Tensor>
+    runtime::cache::CacheBackend::create_dynamic_tensor(const element::Type& type,
+                                                        const PartialShape& shape)
+{
+    return m_wrapped_backend->create_dynamic_tensor(type, shape);
+}
+
+bool runtime::cache::CacheBackend::supports_dynamic_tensors()
+{
+    return m_wrapped_backend->supports_dynamic_tensors();
+}
+
+shared_ptr<runtime::Executable>
+    runtime::cache::CacheBackend::compile(shared_ptr<Function> function,
+                                          bool enable_performance_data)
+{
+    ngraph::pass::PassConfig pass_config;
+    return compile(function, pass_config, enable_performance_data);
+}
+
+shared_ptr<runtime::Executable>
+    runtime::cache::CacheBackend::compile(shared_ptr<Function> function,
+                                          ngraph::pass::PassConfig& pass_config,
+                                          bool enable_performance_data)
+{
+    // The key must be computed before compiling since backends may rewrite function in place
+    uint64_t key;
+    try
+    {
+        key = get_cache_key(function, pass_config, enable_performance_data);
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "Function can not be cached: " << e.what();
+        m_miss_count++;
+        return m_wrapped_backend->compile(function, pass_config, enable_performance_data);
+    }
+
+    {
+        lock_guard<mutex> lock(m_executables_mutex);
+        auto it = m_executables.find(key);
+        if (it != m_executables.end())
+        {
+            m_hit_count++;
+            return it->second;
+        }
+    }
+
+    string path = get_cache_file(key);
+    shared_ptr<Executable> exec = m_disk_cache_enabled ? try_load(path, key) : nullptr;
+    if (exec)
+    {
+        m_hit_count++;
+    }
+    else
+    {
+        m_miss_count++;
+        exec = m_wrapped_backend->compile(function, pass_config, enable_performance_data);
+        if (exec && m_disk_cache_enabled)
+        {
+            store(path, key, exec);
+        }
+    }
+
+    if (exec)
+    {
+        lock_guard<mutex> lock(m_executables_mutex);
+        m_executables.insert({key, exec});
+    }
+    return exec;
+}
+
+shared_ptr<runtime::Executable> runtime::cache::CacheBackend::load(istream& input_stream)
+{
+    return m_wrapped_backend->load(input_stream);
+}
+
+bool runtime::cache::CacheBackend::is_supported(const Node& node) const
+{
+    return m_wrapped_backend->is_supported(node);
+}
+
+bool runtime::cache::CacheBackend::is_supported_property(const Property prop) const
+{
+    return m_wrapped_backend->is_supported_property(prop);
+}
+
+void runtime::cache::CacheBackend::remove_compiled_function(shared_ptr<Executable> exec)
+{
+    {
+        lock_guard<mutex> lock(m_executables_mutex);
+        for (auto it = m_executables.begin(); it != m_executables.end();)
+        {
+            it = (it->second == exec) ? m_executables.erase(it) : next(it);
+        }
+    }
+    m_wrapped_backend->remove_compiled_function(exec);
+}
+
+shared_ptr<Node> runtime::cache::CacheBackend::get_backend_op(const string& op_name, ...)
+{
+    throw ngraph_error("Variadic arguments can not be forwarded, call get_backend_op('" +
+                       op_name + "') on get_wrapped_backend() instead");
+}
+
+uint64_t runtime::cache::CacheBackend::get_cache_key(shared_ptr<Function> function,
+                                                     const ngraph::pass::PassConfig& pass_config,
+                                                     bool enable_performance_data) const
+{
+    static const string s_host_isa = get_host_isa();
+
+    Digest digest;
+    digest.update(m_backend_name);
+    digest.update(string(NGRAPH_VERSION));
+    digest.update(s_host_isa);
+    update(digest, pass_config.get_enables());
+    update(digest, pass_config.get_pass_attributes());
+    digest.update(static_cast<uint64_t>(enable_performance_data));
+    update(digest, function);
+    return digest.get();
+}
+
+string runtime::cache::CacheBackend::get_cache_file(uint64_t key) const
+{
+    stringstream name;
+    name << hex << setfill('0') << setw(16) << key << ".ngcache";
+    return file_util::path_join(m_cache_directory, name.str());
+}
+
+string runtime::cache::CacheBackend::get_cache_file(shared_ptr<Function> function,
+                                                    const ngraph::pass::PassConfig& pass_config,
+                                                    bool enable_performance_data) const
+{
+    return get_cache_file(get_cache_key(function, pass_config, enable_performance_data));
+}
+
+shared_ptr<runtime::Executable> runtime::cache::CacheBackend::try_load(const string& path,
+                                                                       uint64_t key)
+{
+    shared_ptr<Executable> exec;
+    ifstream in(path, ios::binary);
+    if (in)
+    {
+        try
+        {
+            cpio::Reader reader(in);
+            map<string, string> entries;
+            for (const cpio::FileInfo& info : reader.get_file_info())
+            {
+                vector<char> buffer = reader.read(info);
+                entries[info.get_name()] = string(buffer.data(), buffer.size());
+            }
+            // A file copied or renamed into the wrong slot is a miss
+            if (entries["key"] == to_string(key))
+            {
+                stringstream executable(entries["executable"]);
+                exec = m_wrapped_backend->load(executable);
+            }
+        }
+        catch (const exception& e)
+        {
+            // A damaged or stale file is treated as a miss and overwritten by store()
+            NGRAPH_WARN << "Failed to load cached executable " << path << ": " << e.what();
+        }
+    }
+    return exec;
+}
+
+void runtime::cache::CacheBackend::store(const string& path,
+                                         uint64_t key,
+                                         const shared_ptr<Executable>& exec)
+{
+    // Unique per process and per store so concurrent writers never share a temporary file
+    static const unsigned int s_process_tag = random_device()();
+    static atomic<size_t> s_store_index{0};
+    stringstream tmp_name;
+    tmp_name << path << ".tmp." << hex << s_process_tag << "." << s_store_index++;
+    string tmp_path = tmp_name.str();
+
+    bool saved = false;
+    try
+    {
+        stringstream executable;
+        exec->save(executable);
+        string executable_data = executable.str();
+        ofstream out(tmp_path, ios::binary);
+        {
+            cpio::Writer writer(out);
+            string key_data = to_string(key);
+            writer.write("key", key_data.data(), key_data.size());
+            writer.write("executable", executable_data.data(), executable_data.size());
+        }
+        out.close();
+        saved = !out.fail();
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "Executable can not be saved: " << e.what();
+    }
+
+    // rename replaces any file written by a concurrent process for the same key atomically
+    if (saved && rename(tmp_path.c_str(), path.c_str()) == 0)
+    {
+        m_store_count++;
+    }
+    else
+    {
+        remove(tmp_path.c_str());
+        m_store_failure_count++;
+    }
+}
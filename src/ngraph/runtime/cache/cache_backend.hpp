@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cache
+        {
+            class CacheBackend;
+        }
+    }
+}
+
+///
+/// \brief Wrapper class that adds an in-process and a persistent on-disk compilation cache to a
+///        backend.
+///
+/// `compile` keys each function on a 64 bit FNV-1a digest of its graph, with nodes taken in
+/// topological order and referred to by position, together with the pass configuration, the
+/// performance data flag, the backend name, the nGraph version and the host ISA. Op types and
+/// attributes, edges, element types, shapes and the raw bytes of constants are fed into the
+/// digest as the graph is walked, so the key stays small however large the constants are.
+/// Executables are kept in memory for the life of the wrapper, so compiling a structurally
+/// identical function again returns the same executable. Otherwise the file named by the
+/// digest is looked up in the cache directory and handed to the wrapped backend's `load`; on
+/// a miss the function is compiled and the result written with `Executable::save`.
+///
+/// The cache directory is only used when the wrapped backend supports
+/// `Property::executable_save_load`; for other backends compiles are cached in memory only.
+/// Executables that fail to save are likewise cached in memory only.
+///
+/// Files are written to a uniquely named temporary file and renamed into place, so any number
+/// of processes may share one cache directory: readers see either a complete file or none.
+///
+/// This class is instantiated by `ngraph::runtime::Backend::create` when the environment
+/// variable `NGRAPH_COMPILE_CACHE_DIR` names a directory.
+///
+class ngraph::runtime::cache::CacheBackend : public Backend
+{
+public:
+    CacheBackend(std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
+                 const std::string& backend_name,
+                 const std::string& cache_directory);
+
+    std::shared_ptr<Tensor>
+        create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
+
+    std::shared_ptr<Tensor> create_tensor(const element::Type& type, const Shape& shape) override;
+
+    std::shared_ptr<Tensor> create_dynamic_tensor(const element::Type& type,
+                                                  const PartialShape& shape) override;
+
+    bool supports_dynamic_tensors() override;
+
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
+                                        bool enable_performance_data = false) override;
+
+    std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
+                                        ngraph::pass::PassConfig& pass_config,
+                                        bool enable_performance_data = false) override;
+
+    std::shared_ptr<Executable> load(std::istream& input_stream) override;
+
+    bool is_supported(const Node& node) const override;
+    bool is_supported_property(const Property prop) const override;
+
+    void remove_compiled_function(std::shared_ptr<Executable> exec) override;
+
+    /// \brief Variadic arguments can not be forwarded, so this throws. Call `get_backend_op`
+    ///        on `get_wrapped_backend()` instead.
+    std::shared_ptr<ngraph::Node> get_backend_op(const std::string& op_name, ...) override;
+
+    std::shared_ptr<ngraph::runtime::Backend> get_wrapped_backend() const
+    {
+        return m_wrapped_backend;
+    }
+    const std::string& get_cache_directory() const { return m_cache_directory; }
+    /// \brief Returns true when executables are saved to and loaded from the cache directory.
+    bool is_disk_cache_enabled() const { return m_disk_cache_enabled; }
+    /// \brief Returns the number of compiles served from memory or from the cache directory.
+    size_t get_hit_count() const { return m_hit_count; }
+    /// \brief Returns the number of compiles that had to run the wrapped backend's compile.
+    size_t get_miss_count() const { return m_miss_count; }
+    /// \brief Returns the number of compiled executables written to the cache directory.
+    size_t get_store_count() const { return m_store_count; }
+    /// \brief Returns the number of compiled executables that could not be saved or written.
+    size_t get_store_failure_count() const { return m_store_failure_count; }
+    /// \brief Returns the cache file used for `function` compiled with `pass_config`.
+    std::string get_cache_file(std::shared_ptr<Function> function,
+                               const ngraph::pass::PassConfig& pass_config,
+                               bool enable_performance_data) const;
+
+private:
+    uint64_t get_cache_key(std::shared_ptr<Function> function,
+                           const ngraph::pass::PassConfig& pass_config,
+                           bool enable_performance_data) const;
+    std::string get_cache_file(uint64_t key) const;
+    std::shared_ptr<Executable> try_load(const std::string& path, uint64_t key);
+    void store(const std::string& path, uint64_t key, const std::shared_ptr<Executable>& exec);
+
+    std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    std::string m_backend_name;
+    std::string m_cache_directory;
+    bool m_disk_cache_enabled;
+    std::atomic<size_t> m_hit_count{0};
+    std::atomic<size_t> m_miss_count{0};
+    std::atomic<size_t> m_store_count{0};
+    std::atomic<size_t> m_store_failure_count{0};
+    std::mutex m_executables_mutex;
+    std::unordered_map<uint64_t, std::shared_ptr<Executable>> m_executables;
+};
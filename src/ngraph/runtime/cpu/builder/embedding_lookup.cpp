@@ -19,7 +19,7 @@
 
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/kernel/gather.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -30,211 +30,86 @@ namespace ngraph
     {
         namespace cpu
         {
-            template <>
-            void Builder::BUILDER_DECL(ngraph::op::EmbeddingLookup)
+            namespace
             {
-                auto& functors = external_function->get_functors();
+                // Rows are copied in the table's own storage type, which lets int8, f16 and
+                // bf16 tables use the same kernel as f32/f64 ones.
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
+                {
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                CPUKernelFunctor functor;
-                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
-                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
-                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                    auto weights_shape = args[1].get_shape();
+                    size_t element_count = shape_size(args[0].get_shape());
+                    auto index_element_type = args[0].get_element_type();
 
-                if (out[0].get_element_type() != element::f32 &&
-                    out[0].get_element_type() != element::f64)
-                {
-                    throw ngraph_error("Unsupported output element type");
-                }
-                auto in_shape = args[1].get_shape();
-                size_t element_count = shape_size(args[0].get_shape());
-                auto out_shape = out[0].get_shape();
-                auto element_type = out[0].get_element_type();
-                auto index_element_type = args[0].get_element_type();
-                if (element_type == element::f32)
-                {
+                    std::function<decltype(runtime::cpu::kernel::embedding<T, int64_t>)> kernel;
                     if (index_element_type == element::f32)
                     {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<float, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
+                        kernel = runtime::cpu::kernel::embedding<T, float>;
                     }
                     else if (index_element_type == element::i32)
                     {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<float, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
+                        kernel = runtime::cpu::kernel::embedding<T, int32_t>;
                     }
                     else if (index_element_type == element::i64)
                     {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<float, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
+                        kernel = runtime::cpu::kernel::embedding<T, int64_t>;
                     }
                     else
                     {
                         throw ngraph_error(
                             "Unsupported index type in CPU Builder for EmbeddingLookup");
                     }
-                }
-                else if (element_type == element::f64)
-                {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
 
-                            ngraph::runtime::reference::embedding<double, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
+                    return [&,
+                            kernel,
+                            weights_shape,
+                            element_count,
+                            arg0_buffer_index,
+                            arg1_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               element_count,
+                               weights_shape,
+                               ectx->arena);
+                    };
+                }
+            } // namespace
 
-                            ngraph::runtime::reference::embedding<double, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingLookup)
+            {
+                auto& functors = external_function->get_functors();
+                CPUKernelFunctor functor;
 
-                            ngraph::runtime::reference::embedding<double, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
+                auto element_type = out[0].get_element_type();
+                if (element_type == element::f32 || element_type == element::i32 ||
+                    element_type == element::u32)
+                {
+                    functor = prepare_functor<uint32_t>(args, out, external_function);
                 }
-                else if (element_type == element::i32)
+                else if (element_type == element::f64 || element_type == element::i64 ||
+                         element_type == element::u64)
                 {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<int, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<int, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<int, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
+                    functor = prepare_functor<uint64_t>(args, out, external_function);
+                }
+                else if (element_type == element::f16 || element_type == element::bf16 ||
+                         element_type == element::i16 || element_type == element::u16)
+                {
+                    functor = prepare_functor<uint16_t>(args, out, external_function);
+                }
+                else if (element_type == element::i8 || element_type == element::u8)
+                {
+                    functor = prepare_functor<uint8_t>(args, out, external_function);
                 }
                 else
                 {
@@ -18,7 +18,7 @@
 
 #include "ngraph/op/gather.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/cpu/kernel/gather.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -31,6 +31,7 @@ namespace ngraph
         {
             namespace
             {
+                // Gather only moves data, so T is a storage type of the element's size
                 template <typename T>
                 CPUKernelFunctor prepare_functor(const Node* node,
                                                  const vector<TensorViewWrapper>& args,
@@ -48,50 +49,33 @@ namespace ngraph
                     auto axis = gather->get_axis();
                     auto params_shape = args[0].get_shape();
                     auto indices_shape = args[1].get_shape();
-                    auto out_shape = out[0].get_shape();
 
+                    std::function<decltype(runtime::cpu::kernel::gather<T, int64_t>)> kernel;
                     if (is_int64)
                     {
-                        return
-                            [&,
-                             params_shape,
-                             indices_shape,
-                             out_shape,
-                             axis,
-                             params_buffer_index,
-                             indices_buffer_index,
-                             out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::gather<T, int64_t>(
-                                    static_cast<T*>(ctx->buffer_data[params_buffer_index]),
-                                    static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                    static_cast<T*>(ctx->buffer_data[out_buffer_index]),
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis);
-                            };
+                        kernel = runtime::cpu::kernel::gather<T, int64_t>;
                     }
                     else
                     {
-                        return
-                            [&,
-                             params_shape,
-                             indices_shape,
-                             out_shape,
-                             axis,
-                             params_buffer_index,
-                             indices_buffer_index,
-                             out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::gather<T, int32_t>(
-                                    static_cast<T*>(ctx->buffer_data[params_buffer_index]),
-                                    static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                    static_cast<T*>(ctx->buffer_data[out_buffer_index]),
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis);
-                            };
+                        kernel = runtime::cpu::kernel::gather<T, int32_t>;
                     }
+
+                    return [&,
+                            kernel,
+                            params_shape,
+                            indices_shape,
+                            axis,
+                            params_buffer_index,
+                            indices_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[params_buffer_index],
+                               ctx->buffer_data[indices_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               params_shape,
+                               indices_shape,
+                               axis,
+                               ectx->arena);
+                    };
                 }
             } // namespace
 
@@ -105,54 +89,21 @@ namespace ngraph
                 {
                     throw ngraph_error("Unsupported index element type");
                 }
-                auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
-                {
-                    functor = prepare_functor<float>(node, args, out, external_function);
-                }
-                else if (element_type == element::f64)
-                {
-                    functor = prepare_functor<double>(node, args, out, external_function);
-                }
-                else if (element_type == element::i8)
-                {
-                    functor = prepare_functor<int8_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::i16)
-                {
-                    functor = prepare_functor<int16_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::i32)
-                {
-                    functor = prepare_functor<int32_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::i64)
-                {
-                    functor = prepare_functor<int64_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u8)
+                switch (args[0].get_element_type().size())
                 {
+                case 1:
                     functor = prepare_functor<uint8_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u16)
-                {
+                    break;
+                case 2:
                     functor = prepare_functor<uint16_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u32)
-                {
+                    break;
+                case 4:
                     functor = prepare_functor<uint32_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u64)
-                {
+                    break;
+                case 8:
                     functor = prepare_functor<uint64_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::boolean)
-                {
-                    functor = prepare_functor<char>(node, args, out, external_function);
-                }
-                else
-                {
-                    throw ngraph_error("Unsupported type in CPU Builder for Gather");
+                    break;
+                default: throw ngraph_error("Unsupported type in CPU Builder for Gather");
                 }
 
                 functors.emplace_back(functor);
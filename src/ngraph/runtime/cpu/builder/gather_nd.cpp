@@ -18,7 +18,7 @@
 
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/cpu/kernel/gather.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -29,116 +29,74 @@ namespace ngraph
     {
         namespace cpu
         {
-            template <>
-            void Builder::BUILDER_DECL(ngraph::op::GatherND)
+            namespace
             {
-                auto& functors = external_function->get_functors();
-                CPUKernelFunctor functor;
-
-                auto params_buffer_index = external_function->get_buffer_index(args[0].get_name());
-                auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
-                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
-                if (args[1].get_element_type() != element::i64 &&
-                    args[1].get_element_type() != element::i32)
-                {
-                    throw ngraph_error("Unsupported index element type");
-                }
-                bool is_int64 = args[1].get_element_type() == element::i64;
-                auto params_shape = args[0].get_shape();
-                auto indices_shape = args[1].get_shape();
-                auto out_shape = out[0].get_shape();
-                auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+                // GatherND only moves data, so T is a storage type of the element's size
+                template <typename T>
+                CPUKernelFunctor prepare_functor(const vector<TensorViewWrapper>& args,
+                                                 const vector<TensorViewWrapper>& out,
+                                                 CPU_ExternalFunction* external_function)
                 {
+                    auto params_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto indices_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    bool is_int64 = args[1].get_element_type() == element::i64;
+                    auto params_shape = args[0].get_shape();
+                    auto indices_shape = args[1].get_shape();
+
+                    std::function<decltype(runtime::cpu::kernel::gather_nd<T, int64_t>)> kernel;
                     if (is_int64)
                     {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<float, int64_t>(
-                                static_cast<float*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
+                        kernel = runtime::cpu::kernel::gather_nd<T, int64_t>;
                     }
                     else
                     {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<float, int32_t>(
-                                static_cast<float*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
+                        kernel = runtime::cpu::kernel::gather_nd<T, int32_t>;
                     }
+
+                    return [&,
+                            kernel,
+                            params_shape,
+                            indices_shape,
+                            params_buffer_index,
+                            indices_buffer_index,
+                            out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[params_buffer_index],
+                               ctx->buffer_data[indices_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               params_shape,
+                               indices_shape,
+                               ectx->arena);
+                    };
                 }
-                else if (element_type == element::f64)
+            } // namespace
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GatherND)
+            {
+                auto& functors = external_function->get_functors();
+                CPUKernelFunctor functor;
+                if (args[1].get_element_type() != element::i64 &&
+                    args[1].get_element_type() != element::i32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<double, int64_t>(
-                                static_cast<double*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<double, int32_t>(
-                                static_cast<double*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
-                    }
+                    throw ngraph_error("Unsupported index element type");
                 }
-                else
+                switch (args[0].get_element_type().size())
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for GatherND");
+                case 1: functor = prepare_functor<uint8_t>(args, out, external_function); break;
+                case 2: functor = prepare_functor<uint16_t>(args, out, external_function); break;
+                case 4: functor = prepare_functor<uint32_t>(args, out, external_function); break;
+                case 8: functor = prepare_functor<uint64_t>(args, out, external_function); break;
+                default: throw ngraph_error("Unsupported type in CPU Builder for GatherND");
                 }
 
                 functors.emplace_back(functor);
             }
 
             REGISTER_OP_BUILDER(GatherND);
-        }
-    }
-}
+        } // namespace cpu
+    }     // namespace runtime
+} // namespace ngraph
@@ -0,0 +1,333 @@
+//*****************************************************************************
+// Copyright 2018-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <functional>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/loop_kernel.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace
+            {
+                using runtime::cpu::kernel::LoopKernelInput;
+                using runtime::cpu::kernel::LoopKernelInstruction;
+                using runtime::cpu::kernel::LoopKernelOpcode;
+                using runtime::cpu::kernel::LoopKernelProgram;
+
+                // Looks through GOEs that the loop kernel fusion may have inserted between
+                // a kernel argument and its uses inside the kernel
+                const descriptor::Output* get_source_output(const descriptor::Output* output)
+                {
+                    while (auto goe = std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(
+                               output->get_node()))
+                    {
+                        output = &goe->get_inputs().at(goe->get_n()).get_output();
+                    }
+                    return output;
+                }
+
+                // A value of the program before register allocation: either an entry of
+                // program.inputs or the result of an instruction
+                struct LoopKernelValue
+                {
+                    bool is_input;
+                    size_t index;
+                };
+
+                // Translates the node list of a LoopKernel into a register program.
+                // Broadcasts of kernel arguments become strided input loads, and scratch
+                // registers are reused as soon as their last reader has executed.
+                LoopKernelProgram
+                    compile_loop_kernel(const ngraph::runtime::cpu::op::LoopKernel* lk)
+                {
+                    static const std::unordered_map<std::type_index, LoopKernelOpcode> opcodes{
+                        {TI(ngraph::op::Abs), LoopKernelOpcode::Abs},
+                        {TI(ngraph::op::Add), LoopKernelOpcode::Add},
+                        {TI(ngraph::op::Divide), LoopKernelOpcode::Divide},
+                        {TI(ngraph::op::Exp), LoopKernelOpcode::Exp},
+                        {TI(ngraph::op::Log), LoopKernelOpcode::Log},
+                        {TI(ngraph::op::Maximum), LoopKernelOpcode::Maximum},
+                        {TI(ngraph::op::Minimum), LoopKernelOpcode::Minimum},
+                        {TI(ngraph::op::Multiply), LoopKernelOpcode::Multiply},
+                        {TI(ngraph::op::Negative), LoopKernelOpcode::Negative},
+                        {TI(ngraph::op::Relu), LoopKernelOpcode::Relu},
+                        {TI(ngraph::op::Sigmoid), LoopKernelOpcode::Sigmoid},
+                        {TI(ngraph::op::Sqrt), LoopKernelOpcode::Sqrt},
+                        {TI(ngraph::op::Subtract), LoopKernelOpcode::Subtract},
+                        {TI(ngraph::op::Tanh), LoopKernelOpcode::Tanh}};
+
+                    LoopKernelProgram program;
+                    program.shape = lk->get_output_shape(0);
+                    Strides contiguous_strides = row_major_strides(program.shape);
+
+                    std::unordered_map<const descriptor::Output*, size_t> kernel_args;
+                    for (size_t i = 0; i < lk->get_input_size(); i++)
+                    {
+                        kernel_args.emplace(
+                            get_source_output(&lk->get_inputs().at(i).get_output()), i);
+                    }
+
+                    auto find_arg = [&](const descriptor::Output* output) {
+                        auto it = kernel_args.find(output);
+                        if (it == kernel_args.end())
+                        {
+                            throw ngraph_error("LoopKernel node reads a value that is neither a "
+                                               "kernel argument nor a kernel node");
+                        }
+                        return it->second;
+                    };
+
+                    std::vector<LoopKernelInstruction> code;
+                    std::unordered_map<const descriptor::Output*, LoopKernelValue> values;
+                    std::unordered_map<size_t, size_t> contiguous_loads;
+
+                    auto value_of = [&](const descriptor::Output* output) {
+                        output = get_source_output(output);
+                        auto it = values.find(output);
+                        if (it != values.end())
+                        {
+                            return it->second;
+                        }
+                        size_t arg = find_arg(output);
+                        auto load = contiguous_loads.find(arg);
+                        if (load == contiguous_loads.end())
+                        {
+                            load = contiguous_loads.emplace(arg, program.inputs.size()).first;
+                            program.inputs.push_back({arg, contiguous_strides, true});
+                        }
+                        return LoopKernelValue{true, load->second};
+                    };
+
+                    for (const auto& n : lk->get_node_list())
+                    {
+                        if (n->get_output_size() > 1)
+                        {
+                            throw ngraph_error("no multi-output ops in a LoopKernel");
+                        }
+                        const Node& node = *n;
+                        const descriptor::Output* output = &n->get_outputs().at(0);
+
+                        if (TI(node) == TI(ngraph::op::Broadcast))
+                        {
+                            auto broadcast = static_cast<const ngraph::op::Broadcast*>(&node);
+                            auto source =
+                                get_source_output(&broadcast->get_inputs().at(0).get_output());
+                            if (values.count(source) != 0)
+                            {
+                                throw ngraph_error(
+                                    "LoopKernel can only broadcast kernel arguments");
+                            }
+                            const Shape& arg_shape = broadcast->get_argument(0)->get_shape();
+                            Strides arg_strides = row_major_strides(arg_shape);
+                            const AxisSet& axes = broadcast->get_broadcast_axes();
+                            Strides strides;
+                            size_t arg_axis = 0;
+                            for (size_t i = 0; i < program.shape.size(); i++)
+                            {
+                                strides.push_back(axes.count(i) != 0 ? 0
+                                                                     : arg_strides.at(arg_axis++));
+                            }
+                            values[output] = LoopKernelValue{true, program.inputs.size()};
+                            program.inputs.push_back({find_arg(source), strides, false});
+                            continue;
+                        }
+
+                        auto opcode = opcodes.find(TI(node));
+                        if (opcode == opcodes.end())
+                        {
+                            throw ngraph_error("Unsupported op '" + n->description() +
+                                               "' in LoopKernel");
+                        }
+                        auto arg0 = value_of(&n->get_inputs().at(0).get_output());
+                        auto arg1 = n->get_input_size() > 1
+                                        ? value_of(&n->get_inputs().at(1).get_output())
+                                        : arg0;
+                        // Operands hold value ids for now: inputs are encoded as-is and
+                        // instruction results are offset past the inputs once all inputs
+                        // are known
+                        values[output] = LoopKernelValue{false, code.size()};
+                        code.push_back({opcode->second,
+                                        0,
+                                        arg0.is_input ? arg0.index : ~arg0.index,
+                                        arg1.is_input ? arg1.index : ~arg1.index});
+                    }
+
+                    // Kernel outputs produced directly by a load need an explicit copy
+                    const NodeVector& kernel_outputs = lk->get_kernel_outputs();
+                    std::vector<size_t> output_of(code.size(), kernel_outputs.size());
+                    for (size_t i = 0; i < kernel_outputs.size(); i++)
+                    {
+                        auto value = values.at(&kernel_outputs[i]->get_outputs().at(0));
+                        if (value.is_input || output_of[value.index] != kernel_outputs.size())
+                        {
+                            size_t arg = value.is_input ? value.index : ~value.index;
+                            output_of.push_back(i);
+                            code.push_back({LoopKernelOpcode::Copy, 0, arg, arg});
+                        }
+                        else
+                        {
+                            output_of[value.index] = i;
+                        }
+                    }
+
+                    // Last instruction reading each instruction result
+                    std::vector<size_t> last_use(code.size(), 0);
+                    for (size_t k = 0; k < code.size(); k++)
+                    {
+                        for (size_t operand : {code[k].arg0, code[k].arg1})
+                        {
+                            if (operand >= program.inputs.size())
+                            {
+                                last_use[~operand] = k;
+                            }
+                        }
+                    }
+
+                    size_t num_inputs = program.inputs.size();
+                    std::vector<size_t> scratch_of(code.size());
+                    std::vector<size_t> free_scratch;
+                    size_t num_scratch = 0;
+                    for (size_t k = 0; k < code.size(); k++)
+                    {
+                        for (size_t operand : {code[k].arg0, code[k].arg1})
+                        {
+                            if (operand >= num_inputs && last_use[~operand] == k &&
+                                output_of[~operand] == kernel_outputs.size())
+                            {
+                                free_scratch.push_back(scratch_of[~operand]);
+                                last_use[~operand] = code.size();
+                            }
+                        }
+                        if (output_of[k] == kernel_outputs.size())
+                        {
+                            if (free_scratch.empty())
+                            {
+                                free_scratch.push_back(num_scratch++);
+                            }
+                            scratch_of[k] = free_scratch.back();
+                            free_scratch.pop_back();
+                        }
+                    }
+                    program.num_scratch = num_scratch;
+
+                    auto register_of = [&](size_t value) {
+                        if (value < num_inputs)
+                        {
+                            return value;
+                        }
+                        size_t k = ~value;
+                        return output_of[k] == kernel_outputs.size()
+                                   ? num_inputs + scratch_of[k]
+                                   : num_inputs + num_scratch + output_of[k];
+                    };
+                    for (size_t k = 0; k < code.size(); k++)
+                    {
+                        program.instructions.push_back({code[k].opcode,
+                                                        register_of(~k),
+                                                        register_of(code[k].arg0),
+                                                        register_of(code[k].arg1)});
+                    }
+                    return program;
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
+            {
+                auto lk = static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                std::vector<size_t> arg_buffer_indices;
+                for (const auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                std::vector<size_t> out_buffer_indices;
+                for (const auto& output : out)
+                {
+                    out_buffer_indices.push_back(
+                        external_function->get_buffer_index(output.get_name()));
+                }
+
+                std::function<decltype(runtime::cpu::kernel::loop_kernel<float>)> kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       out[0].get_element_type().c_type_string() +
+                                       " for LoopKernel");
+                }
+
+                auto program = compile_loop_kernel(lk);
+                auto functor = [&, kernel, program, arg_buffer_indices, out_buffer_indices](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    std::vector<void*> inputs;
+                    for (auto index : arg_buffer_indices)
+                    {
+                        inputs.push_back(ctx->buffer_data[index]);
+                    }
+                    std::vector<void*> outputs;
+                    for (auto index : out_buffer_indices)
+                    {
+                        outputs.push_back(ctx->buffer_data[index]);
+                    }
+                    kernel(program, inputs, outputs, ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+        }
+    }
+}
@@ -18,7 +18,7 @@
 
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/scatter_nd_add.hpp"
+#include "ngraph/runtime/cpu/kernel/scatter_add.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -47,111 +47,62 @@ namespace ngraph
                 bool is_int64 = args[1].get_element_type() == element::i64;
                 auto inputs_shape = args[0].get_shape();
                 auto indices_shape = args[1].get_shape();
-                auto updates_shape = args[2].get_shape();
-                auto out_shape = out[0].get_shape();
+                bool deterministic = external_function->is_deterministic_scatter();
+
+                std::function<decltype(runtime::cpu::kernel::scatter_nd_add<float, int64_t>)>
+                    kernel;
+
+#define SCATTER_ND_ADD_SELECT_KERNEL(T)                                                            \
+    if (is_int64)                                                                                  \
+    {                                                                                              \
+        kernel = runtime::cpu::kernel::scatter_nd_add<T, int64_t>;                                 \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        kernel = runtime::cpu::kernel::scatter_nd_add<T, int32_t>;                                 \
+    }
+
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::scatter_nd_add<float, int64_t>(
-                                static_cast<float*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::scatter_nd_add<float, int32_t>(
-                                static_cast<float*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
+                    SCATTER_ND_ADD_SELECT_KERNEL(float)
                 }
                 else if (element_type == element::f64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::scatter_nd_add<double, int64_t>(
-                                static_cast<double*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   inputs_shape,
-                                   indices_shape,
-                                   updates_shape,
-                                   out_shape,
-                                   inputs_buffer_index,
-                                   indices_buffer_index,
-                                   updates_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::scatter_nd_add<double, int32_t>(
-                                static_cast<double*>(ctx->buffer_data[inputs_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[updates_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                inputs_shape,
-                                indices_shape,
-                                updates_shape,
-                                out_shape);
-                        };
-                    }
+                    SCATTER_ND_ADD_SELECT_KERNEL(double)
+                }
+                else if (element_type == element::i32)
+                {
+                    SCATTER_ND_ADD_SELECT_KERNEL(int32_t)
+                }
+                else if (element_type == element::i64)
+                {
+                    SCATTER_ND_ADD_SELECT_KERNEL(int64_t)
                 }
                 else
                 {
                     throw ngraph_error("Unsupported type in CPU Builder for ScatterNDAdd");
                 }
+#undef SCATTER_ND_ADD_SELECT_KERNEL
+
+                functor = [&,
+                           kernel,
+                           inputs_shape,
+                           indices_shape,
+                           deterministic,
+                           inputs_buffer_index,
+                           indices_buffer_index,
+                           updates_buffer_index,
+                           out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[inputs_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[updates_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           inputs_shape,
+                           indices_shape,
+                           deterministic,
+                           ectx->arena);
+                };
 
                 functors.emplace_back(functor);
             }
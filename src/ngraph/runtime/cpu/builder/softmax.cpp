@@ -19,6 +19,7 @@
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/log_softmax.hpp"
 #include "ngraph/runtime/reference/softmax.hpp"
 
 using namespace std;
@@ -30,6 +31,49 @@ namespace ngraph
     {
         namespace cpu
         {
+            namespace
+            {
+                // Selects the native single-pass kernel for floating point softmax over a
+                // contiguous range of axes; returns false if it does not apply.
+                bool select_native_softmax(
+                    const element::Type& element_type,
+                    const AxisSet& axes,
+                    bool log,
+                    std::function<decltype(runtime::cpu::kernel::softmax_contiguous<float>)>&
+                        kernel)
+                {
+                    if (!runtime::cpu::kernel::softmax_axes_contiguous(axes))
+                    {
+                        return false;
+                    }
+                    if (element_type == element::f32)
+                    {
+                        kernel = log ? runtime::cpu::kernel::log_softmax_contiguous<float>
+                                     : runtime::cpu::kernel::softmax_contiguous<float>;
+                    }
+                    else if (element_type == element::f64)
+                    {
+                        kernel = log ? runtime::cpu::kernel::log_softmax_contiguous<double>
+                                     : runtime::cpu::kernel::softmax_contiguous<double>;
+                    }
+                    else if (element_type == element::f16)
+                    {
+                        kernel = log ? runtime::cpu::kernel::log_softmax_contiguous<float16>
+                                     : runtime::cpu::kernel::softmax_contiguous<float16>;
+                    }
+                    else if (element_type == element::bf16)
+                    {
+                        kernel = log ? runtime::cpu::kernel::log_softmax_contiguous<bfloat16>
+                                     : runtime::cpu::kernel::softmax_contiguous<bfloat16>;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                    return true;
+                }
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Softmax)
             {
@@ -70,7 +114,23 @@ namespace ngraph
                 }
                 else
                 {
-                    if (axes.size() == arg_shape.size())
+                    std::function<decltype(runtime::cpu::kernel::softmax_contiguous<float>)>
+                        native_kernel;
+                    if (select_native_softmax(
+                            args[0].get_element_type(), axes, false, native_kernel))
+                    {
+                        auto functor =
+                            [&, native_kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
+                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                                native_kernel(ctx->buffer_data[arg_buffer_index],
+                                              ctx->buffer_data[out_buffer_index],
+                                              arg_shape,
+                                              axes,
+                                              ectx->arena);
+                            };
+                        functors.emplace_back(functor);
+                    }
+                    else if (axes.size() == arg_shape.size())
                     {
                         std::function<decltype(runtime::cpu::kernel::softmax_all<float, 1>)> kernel;
 
@@ -195,7 +255,39 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::CPULogSoftmax)
+            {
+                auto log_softmax = static_cast<const ngraph::op::CPULogSoftmax*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                auto arg_shape = args[0].get_shape();
+                auto axes = log_softmax->get_axes();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                std::function<decltype(runtime::cpu::kernel::softmax_contiguous<float>)> kernel;
+                if (!select_native_softmax(args[0].get_element_type(), axes, true, kernel))
+                {
+                    throw ngraph_error("Unsupported CPULogSoftmax " + vector_to_string(arg_shape) +
+                                       " over " + vector_to_string(axes));
+                }
+
+                auto functor = [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           arg_shape,
+                           axes,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
             REGISTER_OP_BUILDER(Softmax);
+            REGISTER_OP_BUILDER(CPULogSoftmax);
         }
     }
 }
@@ -18,7 +18,7 @@
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/topk.hpp"
+#include "ngraph/runtime/cpu/kernel/topk.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -53,109 +53,94 @@ namespace ngraph
                 auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
 
+                std::function<decltype(runtime::cpu::kernel::topk<float, int64_t>)> kernel;
+
+#define TOPK_SELECT_KERNEL(T)                                                                      \
+    if (is_int64)                                                                                  \
+    {                                                                                              \
+        kernel = runtime::cpu::kernel::topk<T, int64_t>;                                           \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        kernel = runtime::cpu::kernel::topk<T, int32_t>;                                           \
+    }
+
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
+                    TOPK_SELECT_KERNEL(float)
                 }
                 else if (element_type == element::f64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
-                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
-                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max);
-                        };
-                    }
+                    TOPK_SELECT_KERNEL(double)
+                }
+                else if (element_type == element::f16)
+                {
+                    TOPK_SELECT_KERNEL(float16)
+                }
+                else if (element_type == element::bf16)
+                {
+                    TOPK_SELECT_KERNEL(bfloat16)
+                }
+                else if (element_type == element::i8)
+                {
+                    TOPK_SELECT_KERNEL(int8_t)
+                }
+                else if (element_type == element::i16)
+                {
+                    TOPK_SELECT_KERNEL(int16_t)
+                }
+                else if (element_type == element::i32)
+                {
+                    TOPK_SELECT_KERNEL(int32_t)
+                }
+                else if (element_type == element::i64)
+                {
+                    TOPK_SELECT_KERNEL(int64_t)
+                }
+                else if (element_type == element::u8)
+                {
+                    TOPK_SELECT_KERNEL(uint8_t)
+                }
+                else if (element_type == element::u16)
+                {
+                    TOPK_SELECT_KERNEL(uint16_t)
+                }
+                else if (element_type == element::u32)
+                {
+                    TOPK_SELECT_KERNEL(uint32_t)
+                }
+                else if (element_type == element::u64)
+                {
+                    TOPK_SELECT_KERNEL(uint64_t)
                 }
                 else
                 {
                     throw ngraph_error("Unsupported type in CPU Builder for TopK");
                 }
+#undef TOPK_SELECT_KERNEL
+
+                functor = [&,
+                           kernel,
+                           in_shape,
+                           out_shape,
+                           axis,
+                           k,
+                           compute_max,
+                           arg_buffer_index,
+                           out_indices_buffer_index,
+                           out_values_buffer_index](CPURuntimeContext* ctx,
+                                                    CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_indices_buffer_index],
+                           ctx->buffer_data[out_values_buffer_index],
+                           in_shape,
+                           out_shape,
+                           axis,
+                           k,
+                           compute_max,
+                           ectx->arena);
+                };
 
                 functors.emplace_back(functor);
             }
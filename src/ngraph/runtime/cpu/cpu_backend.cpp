@@ -14,10 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <sstream>
+#include <thread>
 #include <tbb/tbb_stddef.h>
 
 #include "cpu_backend_visibility.h"
+#include "ngraph/cpio.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
@@ -57,6 +64,73 @@ namespace
         }
         ~CPUStaticInit() {}
     } s_cpu_static_init;
+
+    // Runs the FULL tier compiles of all tiered executables one at a time on a single
+    // background thread, so compiling many executables neither starts a thread per executable
+    // nor competes with the executables' own calls for every core
+    class FullTierCompiler
+    {
+    public:
+        static FullTierCompiler& get()
+        {
+            static FullTierCompiler s_compiler;
+            return s_compiler;
+        }
+
+        // Jobs check is_stopping() between passes and ops, so the running compile is abandoned
+        // and queued ones are skipped rather than holding up process exit
+        ~FullTierCompiler()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_jobs_cv.notify_all();
+            m_thread.join();
+        }
+
+        void enqueue(function<void()> job)
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_jobs.push_back(move(job));
+            }
+            m_jobs_cv.notify_one();
+        }
+
+        bool is_stopping() const { return m_stop; }
+
+    private:
+        FullTierCompiler()
+            : m_thread([this]() { run(); })
+        {
+        }
+
+        void run()
+        {
+            while (true)
+            {
+                function<void()> job;
+                {
+                    unique_lock<mutex> lock(m_mutex);
+                    m_jobs_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+                    if (m_jobs.empty())
+                    {
+                        return;
+                    }
+                    job = move(m_jobs.front());
+                    m_jobs.pop_front();
+                }
+                job();
+            }
+        }
+
+        mutex m_mutex;
+        condition_variable m_jobs_cv;
+        deque<function<void()>> m_jobs;
+        atomic<bool> m_stop{false};
+        thread m_thread;
+    };
 }
 
 shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_frame(
@@ -107,22 +181,192 @@ shared_ptr<runtime::Executable>
 runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              ngraph::pass::PassConfig& pass_config,
                                              bool performance_counters_enabled)
+    : m_pass_config(pass_config)
+{
+    m_tiered_compilation = pass_config.get_pass_attribute("TieredCompilation");
+    if (m_tiered_compilation)
+    {
+        // Each tier compiles its own clone, since the passes rewrite the graph in place and
+        // the caller still owns func
+        m_function_instance = compile_tier(clone_function(*func),
+                                           pass_config,
+                                           performance_counters_enabled,
+                                           CompilationTier::FAST);
+        m_fast_tier_counters.m_compile_microseconds += m_function_instance->m_compile_microseconds;
+        set_parameters_and_results(*func);
+
+        m_full_tier = make_shared<FullTierState>();
+        auto state = m_full_tier;
+        auto full_tier_func = clone_function(*func);
+        auto full_tier_pass_config = m_pass_config;
+        FullTierCompiler::get().enqueue([this,
+                                         state,
+                                         full_tier_func,
+                                         full_tier_pass_config,
+                                         performance_counters_enabled]() mutable {
+            shared_ptr<FunctionInstance> instance;
+            auto is_cancelled = [state]() {
+                return state->m_cancelled || FullTierCompiler::get().is_stopping();
+            };
+            if (!is_cancelled())
+            {
+                try
+                {
+                    // Only touches the clone and the copied config, so the executable may be
+                    // destroyed meanwhile
+                    instance = compile_tier(full_tier_func,
+                                            full_tier_pass_config,
+                                            performance_counters_enabled,
+                                            CompilationTier::FULL,
+                                            is_cancelled);
+                }
+                catch (const exception& e)
+                {
+                    if (!is_cancelled())
+                    {
+                        NGRAPH_WARN
+                            << "CPU full tier compilation failed, staying on the fast tier: "
+                            << e.what();
+                    }
+                }
+            }
+
+            lock_guard<mutex> lock(state->m_mutex);
+            if (instance && !state->m_cancelled)
+            {
+                m_full_tier_counters.m_compile_microseconds += instance->m_compile_microseconds;
+                atomic_store(&m_function_instance, instance);
+            }
+            state->m_done = true;
+            state->m_done_cv.notify_all();
+        });
+    }
+    else
+    {
+        m_function_instance = compile_tier(
+            func, pass_config, performance_counters_enabled, CompilationTier::FULL);
+        m_full_tier_counters.m_compile_microseconds += m_function_instance->m_compile_microseconds;
+        set_parameters_and_results(*func);
+    }
+}
+
+runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<CPU_ExternalFunction> external_function,
+                                             ngraph::pass::PassConfig& pass_config,
+                                             bool performance_counters_enabled)
+    : m_pass_config(pass_config)
+{
+    m_function_instance = build_instance(
+        external_function, pass_config, performance_counters_enabled, CompilationTier::FULL);
+    m_full_tier_counters.m_compile_microseconds += m_function_instance->m_compile_microseconds;
+    set_parameters_and_results(*external_function->get_function());
+}
+
+runtime::cpu::CPU_Executable::~CPU_Executable()
+{
+    // A queued compile is skipped and a running one stops at its next pass or op
+    if (m_full_tier)
+    {
+        lock_guard<mutex> lock(m_full_tier->m_mutex);
+        m_full_tier->m_cancelled = true;
+    }
+}
+
+shared_ptr<runtime::cpu::CPU_Executable::FunctionInstance>
+    runtime::cpu::CPU_Executable::compile_tier(const shared_ptr<Function>& func,
+                                               ngraph::pass::PassConfig& pass_config,
+                                               bool performance_counters_enabled,
+                                               CompilationTier tier,
+                                               const function<bool()>& is_cancelled)
+{
+    // Keeps the compiled graph, which save() writes out
+    auto external_function = make_shared<CPU_ExternalFunction>(func, false);
+    external_function->m_fast_tier = (tier == CompilationTier::FAST);
+    external_function->m_is_cancelled = is_cancelled;
+    return build_instance(external_function, pass_config, performance_counters_enabled, tier);
+}
+
+shared_ptr<runtime::cpu::CPU_Executable::FunctionInstance>
+    runtime::cpu::CPU_Executable::build_instance(
+        const shared_ptr<CPU_ExternalFunction>& external_function,
+        ngraph::pass::PassConfig& pass_config,
+        bool performance_counters_enabled,
+        CompilationTier tier)
+{
+    stopwatch timer;
+    timer.start();
+    auto instance = make_shared<FunctionInstance>();
+    instance->m_performance_counters_enabled = performance_counters_enabled;
+    instance->m_tier = tier;
+    instance->m_external_function = external_function;
+    instance->m_external_function->m_emit_timing = performance_counters_enabled;
+    auto cf = instance->m_external_function->make_call_frame(pass_config);
+    instance->m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+    timer.stop();
+    instance->m_compile_microseconds = timer.get_microseconds();
+    return instance;
+}
+
+shared_ptr<runtime::cpu::CPU_Executable::FunctionInstance>
+    runtime::cpu::CPU_Executable::get_function_instance() const
+{
+    return atomic_load(&m_function_instance);
+}
+
+runtime::cpu::CPU_Executable::TierCounters&
+    runtime::cpu::CPU_Executable::get_tier_counters(CompilationTier tier)
+{
+    return tier == CompilationTier::FAST ? m_fast_tier_counters : m_full_tier_counters;
+}
+
+void runtime::cpu::CPU_Executable::record_call(CompilationTier tier, size_t microseconds)
+{
+    TierCounters& counters = get_tier_counters(tier);
+    counters.m_call_count++;
+    counters.m_call_microseconds += microseconds;
+}
+
+runtime::cpu::CompilationTier runtime::cpu::CPU_Executable::get_compilation_tier() const
 {
-    FunctionInstance& instance = m_function_instance;
-    if (instance.m_external_function == nullptr)
+    return get_function_instance()->m_tier;
+}
+
+void runtime::cpu::CPU_Executable::wait_for_full_tier()
+{
+    if (m_full_tier)
     {
-        instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
-        instance.m_external_function->m_emit_timing = performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame(pass_config);
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        unique_lock<mutex> lock(m_full_tier->m_mutex);
+        m_full_tier->m_done_cv.wait(lock, [this] { return m_full_tier->m_done; });
     }
-    set_parameters_and_results(*func);
+}
+
+runtime::cpu::TierStatistics
+    runtime::cpu::CPU_Executable::get_tier_statistics(CompilationTier tier) const
+{
+    const TierCounters& counters =
+        tier == CompilationTier::FAST ? m_fast_tier_counters : m_full_tier_counters;
+    TierStatistics rc;
+    rc.m_compile_microseconds = counters.m_compile_microseconds;
+    rc.m_call_count = counters.m_call_count;
+    rc.m_call_microseconds = counters.m_call_microseconds;
+    return rc;
 }
 
 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executable::get_call_frame()
 {
-    FunctionInstance& instance = m_function_instance;
-    return instance.m_call_frame;
+    return get_function_instance()->m_call_frame;
+}
+
+shared_ptr<runtime::cpu::CPU_BoundCall>
+    runtime::cpu::CPU_Executable::bind(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                       const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    auto instance = get_function_instance();
+    if (instance->m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before bind().");
+    }
+    validate(outputs, inputs);
+    return make_shared<CPU_BoundCall>(instance->m_call_frame, outputs, inputs);
 }
 
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
@@ -130,18 +374,58 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
 {
     bool rc = true;
 
-    FunctionInstance& instance = m_function_instance;
-    if (instance.m_external_function == nullptr)
+    auto instance = get_function_instance();
+    if (instance->m_external_function == nullptr)
     {
         NGRAPH_INFO;
         throw runtime_error("compile() must be called before call().");
     }
 
-    instance.m_call_frame->call(outputs, inputs);
+    if (m_tiered_compilation)
+    {
+        stopwatch timer;
+        timer.start();
+        instance->m_call_frame->call(outputs, inputs);
+        timer.stop();
+        record_call(instance->m_tier, timer.get_microseconds());
+    }
+    else
+    {
+        instance->m_call_frame->call(outputs, inputs);
+    }
 
     return rc;
 }
 
+void runtime::cpu::CPU_Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                              const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                              CallCallback callback)
+{
+    auto instance = get_function_instance();
+    if (instance->m_external_function == nullptr)
+    {
+        throw runtime_error("compile() must be called before call_async().");
+    }
+
+    if (m_tiered_compilation)
+    {
+        auto start = chrono::steady_clock::now();
+        CompilationTier tier = instance->m_tier;
+        instance->m_call_frame->call_async(
+            outputs, inputs, [this, callback, start, tier](exception_ptr error) {
+                auto elapsed = chrono::steady_clock::now() - start;
+                record_call(tier, chrono::duration_cast<chrono::microseconds>(elapsed).count());
+                callback(error == nullptr, error);
+            });
+    }
+    else
+    {
+        instance->m_call_frame->call_async(outputs, inputs, [callback](exception_ptr error) {
+            callback(error == nullptr, error);
+        });
+    }
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     for (auto it = m_exec_map.begin(); it != m_exec_map.end(); ++it)
@@ -157,23 +441,90 @@ void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable>
 vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performance_data() const
 {
     vector<runtime::PerformanceCounter> rc;
-    const FunctionInstance& instance = m_function_instance;
-    if (instance.m_external_function != nullptr)
+    auto instance = get_function_instance();
+    if (instance->m_external_function != nullptr)
     {
         rc.insert(rc.end(),
-                  instance.m_external_function->get_perf_counters().begin(),
-                  instance.m_external_function->get_perf_counters().end());
+                  instance->m_external_function->get_perf_counters().begin(),
+                  instance->m_external_function->get_perf_counters().end());
     }
     return rc;
 }
 
+static string s_cpu_save_info = "CPU Save File 2.0";
+
+static string pass_map_to_string(const map<string, bool>& pass_map)
+{
+    stringstream ss;
+    for (auto it = pass_map.begin(); it != pass_map.end(); ++it)
+    {
+        ss << (it == pass_map.begin() ? "" : ";") << it->first << "=" << it->second;
+    }
+    return ss.str();
+}
+
+void runtime::cpu::CPU_Executable::save(ostream& out)
+{
+    // Save the optimized graph rather than the FAST tier one
+    wait_for_full_tier();
+    auto instance = get_function_instance();
+    cpio::Writer writer(out);
+    writer.write("save_info", s_cpu_save_info.data(), s_cpu_save_info.size());
+    instance->m_external_function->save(writer);
+    string enables = pass_map_to_string(m_pass_config.get_enables());
+    writer.write("pass_enables", enables.data(), enables.size());
+    string attributes = pass_map_to_string(m_pass_config.get_pass_attributes());
+    writer.write("pass_attributes", attributes.data(), attributes.size());
+    string perf = instance->m_performance_counters_enabled ? "1" : "0";
+    writer.write("performance_counters", perf.data(), perf.size());
+}
+
+shared_ptr<runtime::Executable> runtime::cpu::CPU_Backend::load(istream& in)
+{
+    cpio::Reader reader(in);
+    map<string, string> entries;
+    for (const cpio::FileInfo& info : reader.get_file_info())
+    {
+        vector<char> buffer = reader.read(info);
+        entries[info.get_name()] = string(buffer.data(), buffer.size());
+    }
+    if (entries["save_info"] != s_cpu_save_info)
+    {
+        throw ngraph_error("Stream does not contain a saved CPU executable");
+    }
+
+    // Start from a default config so NGRAPH_PASS_* settings of this process are replaced by
+    // the ones the executable was saved with
+    ngraph::pass::PassConfig pass_config;
+    for (const string& item : split(entries["pass_enables"], ';', false))
+    {
+        auto name_value = split(item, '=', false);
+        if (name_value.size() == 2)
+        {
+            pass_config.set_pass_enable(name_value[0], parse_string<bool>(name_value[1]));
+        }
+    }
+    for (const string& item : split(entries["pass_attributes"], ';', false))
+    {
+        auto name_value = split(item, '=', false);
+        if (name_value.size() == 2)
+        {
+            pass_config.set_pass_attribute(name_value[0], parse_string<bool>(name_value[1]));
+        }
+    }
+    bool performance_counters_enabled = entries["performance_counters"] == "1";
+
+    return make_shared<CPU_Executable>(
+        CPU_ExternalFunction::load(entries), pass_config, performance_counters_enabled);
+}
+
 bool runtime::cpu::CPU_Backend::is_supported(const Node& op) const
 {
     return true;
 }
 bool runtime::cpu::CPU_Backend::is_supported_property(const Property prop) const
 {
-    if (prop == Property::memory_attach)
+    if (prop == Property::memory_attach || prop == Property::executable_save_load)
     {
         return true;
     }
@@ -16,8 +16,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
@@ -31,6 +36,7 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            class CPU_BoundCall;
 
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
@@ -59,6 +65,11 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Executable> exec) override;
 
+                /// \brief Loads an executable written by CPU_Executable::save. The saved
+                ///        graph, memory plan and tensor layouts are used as they are, so no
+                ///        pass runs again and only the DEX functors are rebuilt.
+                std::shared_ptr<Executable> load(std::istream& input_stream) override;
+
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
@@ -67,19 +78,72 @@ namespace ngraph
                     m_exec_map;
             };
 
+            /// \brief Pass pipeline a CPU executable was compiled with. FAST only runs the
+            ///        passes needed for a runnable graph, FULL runs the complete pipeline.
+            enum class CompilationTier
+            {
+                FAST,
+                FULL
+            };
+
+            /// \brief Time spent compiling and executing one compilation tier.
+            struct TierStatistics
+            {
+                size_t m_compile_microseconds = 0;
+                size_t m_call_count = 0;
+                size_t m_call_microseconds = 0;
+            };
+
+            /// \brief With the "TieredCompilation" pass attribute the executable is first compiled
+            ///        at the FAST tier and can be called right away, while the FULL tier is
+            ///        compiled from its own copy of the graph and swapped in once it is ready.
+            ///        FULL tier compiles run one at a time on a background thread shared by all
+            ///        executables. Calls in flight and bound calls keep using the tier they
+            ///        started with.
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
             {
             public:
                 CPU_Executable(std::shared_ptr<Function> func,
                                ngraph::pass::PassConfig& pass_config,
                                bool performance_counters_enabled);
+                /// \brief Wraps a function restored by CPU_ExternalFunction::load
+                CPU_Executable(std::shared_ptr<CPU_ExternalFunction> external_function,
+                               ngraph::pass::PassConfig& pass_config,
+                               bool performance_counters_enabled);
+                ~CPU_Executable() override;
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                using Executable::call_async;
+                void call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                CallCallback callback) override;
+
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Bind input and output tensors once for repeated allocation-free calls.
+                /// \param outputs vector of runtime::Tensor used as outputs
+                /// \param inputs vector of runtime::Tensor used as inputs
+                std::shared_ptr<CPU_BoundCall>
+                    bind(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                         const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief Writes the compiled graph, its memory plan and tensor layouts and
+                ///        the compile options to a cpio archive. Waits for a pending FULL tier
+                ///        compile first. Codegen builds cannot be saved.
+                void save(std::ostream& output_stream) override;
+
+                /// \brief Returns the tier new calls are dispatched to.
+                CompilationTier get_compilation_tier() const;
+
+                /// \brief Blocks until the background FULL tier compile has finished. Returns
+                ///        immediately when tiered compilation is not enabled.
+                void wait_for_full_tier();
+
+                TierStatistics get_tier_statistics(CompilationTier tier) const;
+
             private:
                 class FunctionInstance
                 {
@@ -87,7 +151,53 @@ namespace ngraph
                     std::shared_ptr<CPU_ExternalFunction> m_external_function = nullptr;
                     std::shared_ptr<CPU_CallFrame> m_call_frame = nullptr;
                     bool m_performance_counters_enabled = false;
-                } m_function_instance;
+                    CompilationTier m_tier = CompilationTier::FULL;
+                    size_t m_compile_microseconds = 0;
+                };
+
+                // Shared with the queued FULL tier compile, which can outlive the executable.
+                // The compile stops at the next pass or op once m_cancelled is set, and only
+                // publishes its result while it is not.
+                class FullTierState
+                {
+                public:
+                    std::mutex m_mutex;
+                    std::condition_variable m_done_cv;
+                    bool m_done = false;
+                    std::atomic<bool> m_cancelled{false};
+                };
+
+                class TierCounters
+                {
+                public:
+                    std::atomic<size_t> m_compile_microseconds{0};
+                    std::atomic<size_t> m_call_count{0};
+                    std::atomic<size_t> m_call_microseconds{0};
+                };
+
+                static std::shared_ptr<FunctionInstance>
+                    compile_tier(const std::shared_ptr<Function>& func,
+                                 ngraph::pass::PassConfig& pass_config,
+                                 bool performance_counters_enabled,
+                                 CompilationTier tier,
+                                 const std::function<bool()>& is_cancelled = nullptr);
+                static std::shared_ptr<FunctionInstance>
+                    build_instance(const std::shared_ptr<CPU_ExternalFunction>& external_function,
+                                   ngraph::pass::PassConfig& pass_config,
+                                   bool performance_counters_enabled,
+                                   CompilationTier tier);
+                std::shared_ptr<FunctionInstance> get_function_instance() const;
+                TierCounters& get_tier_counters(CompilationTier tier);
+                void record_call(CompilationTier tier, size_t microseconds);
+
+                // Swapped atomically when the FULL tier replaces the FAST tier
+                std::shared_ptr<FunctionInstance> m_function_instance;
+                bool m_tiered_compilation = false;
+                std::shared_ptr<FullTierState> m_full_tier;
+                TierCounters m_fast_tier_counters;
+                TierCounters m_full_tier_counters;
+
+                ngraph::pass::PassConfig m_pass_config;
             };
         }
     }
@@ -47,6 +47,8 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
             std::to_string(std::thread::hardware_concurrency()) + "]");
     }
 
+    m_context_affinity = std::getenv("NGRAPH_CPU_CONTEXT_AFFINITY") != nullptr;
+
     setup_runtime_context();
     if (!m_external_function->is_direct_execution())
     {
@@ -58,6 +60,7 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
+    stop_async_workers();
     cleanup_runtime_context();
     if (!m_external_function->is_direct_execution())
     {
@@ -78,15 +81,6 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
-        if (disable_caching)
-        {
-            m_ctx_vec[id]->p_en[i] = true;
-        }
-        else
-        {
-            m_ctx_vec[id]->p_en[i] = tv->get_stale();
-        }
-
         inputs.push_back(tv->get_data_ptr());
     }
     for (size_t i = 0; i < output_tvs.size(); i++)
@@ -96,6 +90,31 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    update_input_staleness(input_tvs, id, disable_caching);
+    execute(inputs, outputs, id);
+}
+
+void runtime::cpu::CPU_CallFrame::update_input_staleness(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    const size_t id,
+    const bool disable_caching)
+{
+    for (size_t i = 0; i < input_tvs.size(); i++)
+    {
+        bool stale = disable_caching || input_tvs[i]->get_stale();
+        // Every stale input starts a new version of that input. A context that last ran
+        // with an older version has not seen the current value, even if the tensor is
+        // not stale from the caller's point of view.
+        size_t version = stale ? ++m_input_versions[i] : m_input_versions[i].load();
+        m_ctx_vec[id]->p_en[i] = stale || m_ctx_input_versions[id][i] != version;
+        m_ctx_input_versions[id][i] = version;
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::execute(std::vector<void*>& inputs,
+                                          std::vector<void*>& outputs,
+                                          const size_t id)
+{
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -114,48 +133,256 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     }
 }
 
+namespace
+{
+    // Context last released by this thread, used as a hint when context affinity is enabled
+    struct ContextHint
+    {
+        const void* call_frame;
+        size_t id;
+    };
+    thread_local ContextHint s_context_hint{nullptr, 0};
+
+    const uint64_t s_index_mask = 0xffffffffULL;
+}
+
+bool runtime::cpu::CPU_CallFrame::try_pop_context(size_t& id)
+{
+    uint64_t head = m_free_head.load(std::memory_order_acquire);
+    while (true)
+    {
+        uint32_t top = static_cast<uint32_t>(head & s_index_mask);
+        if (top == m_num_ctx)
+        {
+            return false;
+        }
+        // m_free_next[top] may be overwritten concurrently if top is popped and pushed back
+        // meanwhile, but then the tag has moved on and the exchange below fails.
+        uint64_t next = m_free_next[top].load(std::memory_order_relaxed);
+        uint64_t new_head = ((head >> 32) + 1) << 32 | next;
+        if (m_free_head.compare_exchange_weak(
+                head, new_head, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            id = top;
+            return true;
+        }
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::push_context(size_t id)
+{
+    uint64_t head = m_free_head.load(std::memory_order_relaxed);
+    while (true)
+    {
+        m_free_next[id].store(static_cast<uint32_t>(head & s_index_mask),
+                              std::memory_order_relaxed);
+        uint64_t new_head = ((head >> 32) + 1) << 32 | id;
+        if (m_free_head.compare_exchange_weak(
+                head, new_head, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+}
+
+bool runtime::cpu::CPU_CallFrame::try_claim_parked_context(size_t& id)
+{
+    for (size_t i = 0; i < m_num_ctx; i++)
+    {
+        if (m_ctx_parked[i].load(std::memory_order_relaxed) &&
+            m_ctx_parked[i].exchange(false, std::memory_order_acquire))
+        {
+            id = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t runtime::cpu::CPU_CallFrame::acquire_context()
+{
+    size_t id = 0;
+    bool claimed = false;
+    if (m_context_affinity)
+    {
+        const ContextHint& hint = s_context_hint;
+        if (hint.call_frame == this && hint.id < m_num_ctx &&
+            m_ctx_parked[hint.id].exchange(false, std::memory_order_acquire))
+        {
+            id = hint.id;
+            claimed = true;
+        }
+    }
+    if (!claimed)
+    {
+        claimed = try_pop_context(id) || (m_context_affinity && try_claim_parked_context(id));
+    }
+    if (!claimed)
+    {
+        std::unique_lock<std::mutex> lck(m_mutex);
+        m_num_waiters++;
+        // The waiter count is published before checking again, so a release that the
+        // check misses is guaranteed to see it and notify.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!try_pop_context(id) && !(m_context_affinity && try_claim_parked_context(id)))
+        {
+            m_cv.wait(lck);
+        }
+        m_num_waiters--;
+    }
+    m_ctx_vec[id]->pc = 0;
+    return id;
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    if (m_context_affinity)
+    {
+        s_context_hint = {this, id};
+        m_ctx_parked[id].store(true, std::memory_order_release);
+    }
+    else
+    {
+        push_context(id);
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_num_waiters.load(std::memory_order_relaxed) > 0)
+    {
+        // Taking the mutex orders the notification after the waiter's last check
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+        }
+        m_cv.notify_one();
+    }
+}
+
 void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    auto id = 0;
-    auto disable_caching = false;
+    auto id = acquire_context();
+    try
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+        inner_call(output_tvs, input_tvs, id, false);
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::bound_call(CPU_BoundCall& bound)
+{
+    auto id = acquire_context();
+    try
+    {
+        update_input_staleness(bound.m_input_tvs, id, false);
+        execute(bound.m_inputs, bound.m_outputs, id);
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+    release_context(id);
+}
+
+runtime::cpu::CPU_BoundCall::CPU_BoundCall(
+    const std::shared_ptr<CPU_CallFrame>& call_frame,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+    : m_call_frame(call_frame)
+    , m_input_tvs(input_tvs)
+    , m_output_tvs(output_tvs)
+{
+    m_call_frame->propagate_layouts(
+        m_output_tvs, m_call_frame->m_external_function->get_result_layout_descriptors());
+    for (auto& input_tv : m_input_tvs)
+    {
+        m_inputs.push_back(
+            static_pointer_cast<runtime::cpu::CPUTensorView>(input_tv)->get_data_ptr());
+    }
+    for (auto& output_tv : m_output_tvs)
+    {
+        m_outputs.push_back(
+            static_pointer_cast<runtime::cpu::CPUTensorView>(output_tv)->get_data_ptr());
+    }
+}
+
+void runtime::cpu::CPU_BoundCall::call()
+{
+    m_call_frame->bound_call(*this);
+}
+
+void runtime::cpu::CPU_CallFrame::call_async(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    std::function<void(std::exception_ptr)> callback)
+{
+    std::unique_lock<std::mutex> lck(m_async_mutex);
+    if (m_async_workers.empty())
+    {
+        // Workers are started lazily so that purely synchronous users don't pay for them.
+        // Each worker holds at most one runtime context at a time.
+        for (size_t i = 0; i < m_num_ctx; i++)
         {
-            m_cv.wait(lck);
+            m_async_workers.emplace_back(&CPU_CallFrame::async_worker, this);
+        }
+    }
+    m_async_queue.emplace_back([this, output_tvs, input_tvs, callback]() {
+        std::exception_ptr error;
+        try
+        {
+            call(output_tvs, input_tvs);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
         }
+        callback(error);
+    });
+    lck.unlock();
+    m_async_cv.notify_one();
+}
 
-        for (auto i = 0; i < m_num_ctx; i++)
+void runtime::cpu::CPU_CallFrame::async_worker()
+{
+    while (true)
+    {
+        std::function<void()> task;
         {
-            if (m_id_pool[i])
+            std::unique_lock<std::mutex> lck(m_async_mutex);
+            while (m_async_queue.empty() && !m_async_shutdown)
             {
-                id = i;
-                break;
+                m_async_cv.wait(lck);
             }
+            // Drain pending calls before honoring a shutdown request
+            if (m_async_queue.empty())
+            {
+                return;
+            }
+            task = std::move(m_async_queue.front());
+            m_async_queue.pop_front();
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
-        {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
-        }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
+        task();
     }
+}
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
-
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+void runtime::cpu::CPU_CallFrame::stop_async_workers()
+{
+    {
+        std::lock_guard<std::mutex> lck(m_async_mutex);
+        m_async_shutdown = true;
+    }
+    m_async_cv.notify_all();
+    for (auto& worker : m_async_workers)
+    {
+        worker.join();
+    }
+    m_async_workers.clear();
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -180,9 +407,16 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
 
 void runtime::cpu::CPU_CallFrame::setup_runtime_context()
 {
+    const size_t num_inputs = m_external_function->get_parameter_layout_descriptors().size();
+    m_input_versions.reset(new std::atomic<size_t>[num_inputs]);
+    for (size_t i = 0; i < num_inputs; i++)
+    {
+        m_input_versions[i] = 0;
+    }
+    m_ctx_input_versions.assign(m_num_ctx, std::vector<size_t>(num_inputs, 0));
+
     for (auto i = 0; i < m_num_ctx; i++)
     {
-        m_id_pool[i] = true;
         auto ctx = new CPURuntimeContext;
         m_ctx_vec.push_back(ctx);
 
@@ -192,7 +426,8 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
         {
             ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
         }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+        ctx->p_en = new bool[num_inputs];
+        ctx->tensor_stale = new bool[m_external_function->get_tensor_stale_count()]();
 
         ctx->first_iteration = true;
 
@@ -234,7 +469,16 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
                 new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
         }
     }
-    m_num_ctx_available = m_num_ctx;
+
+    // Initially every context is on the free stack, context 0 on top
+    m_free_next.reset(new std::atomic<uint32_t>[m_num_ctx]);
+    m_ctx_parked.reset(new std::atomic<bool>[m_num_ctx]);
+    for (size_t i = 0; i < m_num_ctx; i++)
+    {
+        m_free_next[i] = static_cast<uint32_t>(i + 1);
+        m_ctx_parked[i] = false;
+    }
+    m_free_head = 0;
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
@@ -246,6 +490,7 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 
         delete[] ctx->op_durations;
         delete[] ctx->p_en;
+        delete[] ctx->tensor_stale;
         for (auto p : ctx->mkldnn_primitives)
         {
             delete p;
@@ -276,5 +521,5 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         }
         delete ctx;
     }
-    m_num_ctx_available = 0;
+    m_free_head = m_num_ctx;
 }
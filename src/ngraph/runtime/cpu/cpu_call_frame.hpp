@@ -16,11 +16,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -38,6 +43,7 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_Debugger;
+            class CPU_BoundCall;
 
             using InitContextFuncTy = CPURuntimeContextCG*();
             using DestroyContextFuncTy = void(CPURuntimeContextCG*);
@@ -55,6 +61,7 @@ namespace ngraph
             {
             public:
                 friend class CPU_Debugger;
+                friend class CPU_BoundCall;
 
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
                               InitContextFuncCG compiled_init_ctx_func,
@@ -68,6 +75,16 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Queue an invocation of the function and return immediately.
+                ///
+                /// Queued invocations are executed by a set of worker threads, one per runtime
+                /// context, so up to NGRAPH_CPU_CONCURRENCY invocations run at the same time.
+                /// `callback` is invoked from the worker thread once the invocation is done,
+                /// with the exception it threw, if any.
+                void call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                std::function<void(std::exception_ptr)> callback);
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
@@ -85,16 +102,65 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                void async_worker();
+                void stop_async_workers();
+
+                /// Blocks until a runtime context is free, claims it and returns its index.
+                /// Does not take a lock unless all contexts are in use.
+                size_t acquire_context();
+                void release_context(size_t id);
+                void update_input_staleness(
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                    const size_t id,
+                    const bool disable_caching);
+                void execute(std::vector<void*>& inputs,
+                             std::vector<void*>& outputs,
+                             const size_t id);
+                void bound_call(CPU_BoundCall& bound);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
-                std::mutex m_mutex;
-                std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
+                bool try_pop_context(size_t& id);
+                void push_context(size_t id);
+                bool try_claim_parked_context(size_t& id);
+
                 size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
+                /* Free runtime contexts */
+
+                /// Head of a lock-free stack of free context indices. The low 32 bits hold the
+                /// index of the top context, m_num_ctx when the stack is empty, and the high 32
+                /// bits a tag bumped by every update so that a stale compare-exchange can't
+                /// succeed after the stack went through an A-B-A sequence.
+                std::atomic<uint64_t> m_free_head{0};
+                /// m_free_next[i] is the index below context i while i is on the stack.
+                std::unique_ptr<std::atomic<uint32_t>[]> m_free_next;
+                /// With NGRAPH_CPU_CONTEXT_AFFINITY set, released contexts are parked rather
+                /// than pushed so the releasing thread can take the same one back next time.
+                /// Parked contexts are still handed to any thread when the stack is empty.
+                bool m_context_affinity = false;
+                std::unique_ptr<std::atomic<bool>[]> m_ctx_parked;
+                /// Threads blocked in acquire_context wait on m_cv; m_num_waiters lets
+                /// release_context skip the mutex while nobody is waiting.
+                std::atomic<size_t> m_num_waiters{0};
+                std::mutex m_mutex;
+                std::condition_variable m_cv;
+
+                /// Number of times each input has been passed in as stale.
+                std::unique_ptr<std::atomic<size_t>[]> m_input_versions;
+                /// Version of each input last seen by each context; lets a context tell
+                /// whether its cached results were computed from the current input values.
+                std::vector<std::vector<size_t>> m_ctx_input_versions;
+
+                /* Asynchronous calls */
+
+                std::mutex m_async_mutex;
+                std::condition_variable m_async_cv;
+                std::deque<std::function<void()>> m_async_queue;
+                std::vector<std::thread> m_async_workers;
+                bool m_async_shutdown = false;
+
                 /* Codegen specific */
 
                 /// Function that initializes the context used in codegen mode.
@@ -108,6 +174,37 @@ namespace ngraph
                 /// Execution context used in codegen mode.
                 CPURuntimeContextCG* cg_ctx = nullptr;
             };
+
+            /// \brief An invocation of a compiled function with its input and output tensors
+            ///        bound ahead of time.
+            ///
+            /// Layouts are propagated to the outputs and tensor data pointers are resolved once,
+            /// when the call is bound. Each subsequent `call()` then runs the function without
+            /// allocating memory. The bound tensors are kept alive by this object; their contents
+            /// may be rewritten between calls, and inputs may be marked as not stale to enable
+            /// caching exactly as with `CPU_CallFrame::call`.
+            class CPU_BoundCall
+            {
+            public:
+                friend class CPU_CallFrame;
+
+                CPU_BoundCall(const std::shared_ptr<CPU_CallFrame>& call_frame,
+                              const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                /// \brief Invoke the function on the bound tensors.
+                void call();
+
+            private:
+                CPU_BoundCall(const CPU_BoundCall&) = delete;
+                CPU_BoundCall& operator=(const CPU_BoundCall&) = delete;
+
+                std::shared_ptr<CPU_CallFrame> m_call_frame;
+                std::vector<std::shared_ptr<runtime::Tensor>> m_input_tvs;
+                std::vector<std::shared_ptr<runtime::Tensor>> m_output_tvs;
+                std::vector<void*> m_inputs;
+                std::vector<void*> m_outputs;
+            };
         }
     }
 }
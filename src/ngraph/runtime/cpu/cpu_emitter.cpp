@@ -123,6 +123,7 @@
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+#include "ngraph/runtime/cpu/op/log_softmax.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -3288,6 +3289,23 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::CPULogSoftmax)
+            {
+                auto log_softmax = static_cast<const ngraph::op::CPULogSoftmax*>(node);
+                writer.block_begin();
+                writer << "reference::softmax<" << out[0].get_type() << ">(" << args[0].get_name()
+                       << ",\n";
+                writer << "                   " << out[0].get_name() << ",\n";
+                writer << "                   {" << join(args[0].get_shape()) << "},\n";
+                writer << "                   {" << join(log_softmax->get_axes()) << "});\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << out[0].get_name() << "[i] = std::log(" << out[0].get_name() << "[i]);\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::BoundedRelu)
             {
@@ -3800,6 +3818,19 @@ namespace ngraph
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
+                auto expe =
+                    std::bind(emit_function_call, std::string("std::exp"), std::placeholders::_1);
+                auto loge =
+                    std::bind(emit_function_call, std::string("std::log"), std::placeholders::_1);
+                auto sqrte =
+                    std::bind(emit_function_call, std::string("std::sqrt"), std::placeholders::_1);
+                auto tanhe =
+                    std::bind(emit_function_call, std::string("std::tanh"), std::placeholders::_1);
+                auto sigmoide = [](const std::vector<std::string>& args) {
+                    return "1 / (1 + std::exp(-" + args.at(0) + "))";
+                };
 
                 return std::unordered_map<
                     std::type_index,
@@ -3811,6 +3842,13 @@ namespace ngraph
                     {TI(ngraph::op::Add), adde},
                     {TI(ngraph::op::Negative), nege},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Multiply), mule},
+                    {TI(ngraph::op::Divide), dive},
+                    {TI(ngraph::op::Exp), expe},
+                    {TI(ngraph::op::Log), loge},
+                    {TI(ngraph::op::Sqrt), sqrte},
+                    {TI(ngraph::op::Tanh), tanhe},
+                    {TI(ngraph::op::Sigmoid), sigmoide},
                 };
             }
 
@@ -3821,7 +3859,7 @@ namespace ngraph
             // GOEE doesn't see GOEs in subgraphs that are hidden inside LoopKernels
             // we have to manually propagate the source output
             static const ngraph::descriptor::Output*
-                get_goe_input_output(ngraph::descriptor::Output* output)
+                get_goe_input_output(const ngraph::descriptor::Output* output)
             {
                 auto it = output;
                 while (auto goe =
@@ -3832,6 +3870,26 @@ namespace ngraph
                 return it;
             }
 
+            // Index of the broadcast source element read by output element i
+            static std::string emit_broadcast_index(const ngraph::op::Broadcast* broadcast)
+            {
+                const Shape& shape = broadcast->get_shape();
+                Strides strides = row_major_strides(shape);
+                Strides arg_strides = row_major_strides(broadcast->get_argument(0)->get_shape());
+                std::vector<std::string> terms;
+                size_t arg_axis = 0;
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    if (broadcast->get_broadcast_axes().count(i) == 0)
+                    {
+                        terms.push_back("(i / " + std::to_string(strides[i]) + " % " +
+                                        std::to_string(shape[i]) + ") * " +
+                                        std::to_string(arg_strides[arg_axis++]));
+                    }
+                }
+                return terms.empty() ? "0" : join(terms, " + ");
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::runtime::cpu::op::LoopKernel)
             {
@@ -3845,11 +3903,15 @@ namespace ngraph
                 NodeVector output_nodes = clk->get_kernel_outputs();
                 NodeVector node_list = clk->get_node_list();
 
+                // kernel argument index of each input, for broadcasts that index it directly
+                std::unordered_map<const ngraph::descriptor::Output*, size_t> kernel_args;
                 for (size_t i = 0; i < args.size(); i++)
                 {
                     std::string sname = std::string(args[i].get_name()) + "[i]";
                     auto entry = std::make_pair(&clk->get_inputs().at(i).get_output(), sname);
                     loop_symbol_table.insert(entry);
+                    kernel_args.emplace(get_goe_input_output(&clk->get_inputs().at(i).get_output()),
+                                        i);
                 }
 
                 // add outputs so we write output values directly into their
@@ -3907,6 +3969,21 @@ namespace ngraph
                     }
 
                     const Node& n = *op_node;
+                    if (TI(n) == TI(ngraph::op::Broadcast))
+                    {
+                        // Broadcasts only read kernel arguments
+                        auto arg = kernel_args.find(
+                            get_goe_input_output(&op_node->get_inputs().at(0).get_output()));
+                        if (arg == kernel_args.end())
+                        {
+                            throw ngraph_error("LoopKernel can only broadcast kernel arguments");
+                        }
+                        writer << tmp << " = " << args[arg->second].get_name() << "["
+                               << emit_broadcast_index(
+                                      static_cast<const ngraph::op::Broadcast*>(&n))
+                               << "];\n";
+                        continue;
+                    }
                     auto emitter = inline_emitters.at(TI(n));
                     writer << tmp << " = " << emitter(sargs) << ";\n";
                 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -23,6 +24,8 @@
 #include <typeinfo>
 #include <unordered_map>
 
+#include "nlohmann/json.hpp"
+
 #define TBB_PREVIEW_FLOW_GRAPH_TRACE 1
 
 #include <tbb/flow_graph.h>
@@ -33,6 +36,7 @@
 #include "ngraph/codegen/execution_engine.hpp"
 #endif
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/file_util.hpp"
@@ -140,6 +144,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
 #include "ngraph/pass/propagate_cacheability.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
@@ -154,6 +159,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/cpu_op_serializer.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/cpu_visualize_tree.hpp"
@@ -168,6 +174,7 @@
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+#include "ngraph/runtime/cpu/op/log_softmax.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -182,6 +189,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
@@ -193,6 +201,7 @@
 
 using namespace std;
 using namespace ngraph;
+using json = nlohmann::json;
 
 #define STR(s) #s
 
@@ -222,12 +231,43 @@ using namespace ngraph;
         pass_manager.register_pass<prefix::name>(__VA_ARGS__);                                     \
     }
 
+// Evaluates the constant subgraphs handed over by ConstantFolding's generic step with a nested
+// DEX compile. The nested compile must not fold generically itself, or it would hand the same
+// subgraph back.
+static vector<shared_ptr<op::Constant>> evaluate_constant_function(const shared_ptr<Function>& f)
+{
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (auto& result : f->get_results())
+    {
+        outputs.push_back(make_shared<runtime::cpu::CPUTensorView>(result->get_element_type(),
+                                                                   result->get_shape()));
+    }
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("ConstantFolding::DisableGeneric", true);
+    auto external_function = make_shared<runtime::cpu::CPU_ExternalFunction>(f);
+    external_function->make_call_frame(pass_config)->call(outputs, {});
+
+    vector<shared_ptr<op::Constant>> constants;
+    for (auto& output : outputs)
+    {
+        vector<char> data(output->get_size_in_bytes());
+        output->read(data.data(), 0, data.size());
+        constants.push_back(make_shared<op::Constant>(
+            output->get_element_type(), output->get_shape(), data.data()));
+    }
+    return constants;
+}
+
 runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     const shared_ptr<ngraph::Function>& function, bool release_function)
     : m_function(function)
     , m_release_function(release_function)
     , m_emit_timing(false)
+    , m_fast_tier(false)
+    , m_is_loaded(false)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_deterministic_scatter(std::getenv("NGRAPH_CPU_DETERMINISTIC_SCATTER") != nullptr)
 #if !defined(NGRAPH_DEX_ONLY)
     , m_is_compiled(false)
     , m_direct_execution((std::getenv("NGRAPH_CODEGEN") == nullptr) ||
@@ -424,6 +464,7 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::And), &runtime::cpu::CPU_Emitter::emit<op::And>},
     {TI(ngraph::op::Or), &runtime::cpu::CPU_Emitter::emit<op::Or>},
     {TI(ngraph::op::CPULeakyRelu), &runtime::cpu::CPU_Emitter::emit<op::CPULeakyRelu>},
+    {TI(ngraph::op::CPULogSoftmax), &runtime::cpu::CPU_Emitter::emit<op::CPULogSoftmax>},
     {TI(ngraph::runtime::cpu::op::LoopKernel),
      &runtime::cpu::CPU_Emitter::emit<runtime::cpu::op::LoopKernel>},
     {TI(ngraph::op::LRN), &runtime::cpu::CPU_Emitter::emit<ngraph::op::LRN>},
@@ -492,7 +533,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
         femitter, node_function_map, common_function_string);
     pass_manager.run_passes(m_function);
 
-    unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
+    unordered_map<shared_ptr<Function>, vector<shared_ptr<Node>>> function_ordered_ops;
     // only one function is allowed
     NGRAPH_CHECK(pass_manager.get_state().get_functions().size() == 1,
                  "only one function is allowed");
@@ -563,6 +604,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/reference/scatter_add.hpp"
 #include "ngraph/runtime/reference/scatter_nd_add.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/shape.hpp"
@@ -1152,6 +1194,10 @@ using namespace ngraph::runtime;
 void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     ngraph::pass::Manager& pass_manager, ngraph::pass::PassConfig& pass_config)
 {
+    if (m_is_cancelled)
+    {
+        pass_manager.set_cancellation_check(m_is_cancelled);
+    }
     auto pass_map = pass_config.get_enables();
 
     auto dex = is_direct_execution();
@@ -1181,50 +1227,88 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
 
     REGISTER_KNOBBED_PASS(LikeReplacement, true, ngraph::pass);
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported);
-    REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass);
-    REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass);
-    REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass);
-    REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(BiDirectionalRnn, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPURnnMatFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(BatchFusion, true, ngraph::pass);
-    REGISTER_KNOBBED_PASS(CPUBatchFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(ReshapeSinking, false, ngraph::pass);
-    REGISTER_KNOBBED_PASS(ReshapeElimination, false, ngraph::pass);
-    REGISTER_KNOBBED_PASS_WITH_ARGS(
-        CoreFusion, true, ngraph::pass, ngraph::pass::FusionType::ALL_FUSIONS);
-    REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported);
-    REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass);
+    if (m_fast_tier)
+    {
+        // Fast tier: only the passes needed to get a runnable graph. Fusions, constant
+        // folding and layout optimizations are left to the full tier.
+        REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this);
+        REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this);
+    }
+    else
+    {
+        REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass);
+        REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass);
+        REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass);
+        REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(BiDirectionalRnn, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(CPURnnMatFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(BatchFusion, true, ngraph::pass);
+        REGISTER_KNOBBED_PASS(CPUBatchFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(ReshapeSinking, false, ngraph::pass);
+        REGISTER_KNOBBED_PASS(ReshapeElimination, false, ngraph::pass);
+        REGISTER_KNOBBED_PASS_WITH_ARGS(
+            CoreFusion, true, ngraph::pass, ngraph::pass::FusionType::ALL_FUSIONS);
+        REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported);
+        REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass);
 #if defined(NGRAPH_HALIDE)
-    REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass);
+#else
+        REGISTER_KNOBBED_PASS(CPULoopKernelFusion, false, runtime::cpu::pass);
 #endif
 
-    NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
-    REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false);
-    REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this);
-    REGISTER_KNOBBED_PASS_WITH_ARGS(
-        ConstantFolding, true, ngraph::pass, GetGlobalCFDispatcherCPU());
-    REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this);
-    REGISTER_KNOBBED_PASS_WITH_ARGS(
-        CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map());
-    REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass);
-    REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass);
-    REGISTER_KNOBBED_PASS_WITH_ARGS(
-        PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory());
+        NodeVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
+        REGISTER_KNOBBED_PASS_WITH_ARGS(
+            CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false);
+        REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this);
+        bool fold_generic = !pass_config.get_pass_attribute("ConstantFolding::DisableGeneric");
+        REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding,
+                                        true,
+                                        ngraph::pass,
+                                        GetGlobalCFDispatcherCPU(),
+                                        fold_generic,
+                                        evaluate_constant_function);
+        REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this);
+        REGISTER_KNOBBED_PASS_WITH_ARGS(CommonSubexpressionElimination,
+                                        true,
+                                        ngraph::pass,
+                                        runtime::cpu::get_cse_handlers_map());
+        REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass);
+        REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass);
+        REGISTER_KNOBBED_PASS_WITH_ARGS(
+            PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory());
+        REGISTER_KNOBBED_PASS(MemorySchedule, false, ngraph::pass);
+    }
+
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
+    bool interval_planning =
+        pass_config.get_pass_attribute("CPUMemoryAssignment::IntervalPlanning");
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
-        bufferID_to_tensorSets, tensor_to_bufferID, size_t(s_memory_pool_alignment), !reuse_memory);
+        bufferID_to_tensorSets,
+        tensor_to_bufferID,
+        size_t(s_memory_pool_alignment),
+        !reuse_memory,
+        interval_planning);
 
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
 
+size_t runtime::cpu::CPU_ExternalFunction::get_tensor_stale_index(const std::string& name)
+{
+    auto it = m_tensor_stale_indices.find(name);
+    if (it == m_tensor_stale_indices.end())
+    {
+        it = m_tensor_stale_indices.emplace(name, m_tensor_stale_indices.size()).first;
+    }
+    return it->second;
+}
+
 bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
 {
     for (size_t i = 0; i < node->get_output_size(); i++)
@@ -1257,9 +1341,13 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     static const string s_debug_dir = "cpu_codegen";
     static StaticInitializers s_static_initializers(s_debug_dir);
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
-    ngraph::pass::Manager pass_manager;
-    register_common_passes(pass_manager, pass_config);
-    pass_manager.run_passes(m_function, false);
+    // A loaded function already holds the graph and memory plan the passes produced
+    if (!m_is_loaded)
+    {
+        ngraph::pass::Manager pass_manager;
+        register_common_passes(pass_manager, pass_config);
+        pass_manager.run_passes(m_function, false);
+    }
 
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
@@ -1353,7 +1441,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             auto output_tensor = &param->get_outputs().at(i).get_tensor();
             auto tensor_set = get_tensor_set(output_tensor);
 
-            auto& stale = tensor_stale[output_tensor->get_name()];
+            auto stale = get_tensor_stale_index(output_tensor->get_name());
             // process all tensors in the set containing the output tensor of the parameter
             for (auto& ele_t : tensor_set)
             {
@@ -1396,6 +1484,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             continue;
         }
+        if (m_is_cancelled && m_is_cancelled())
+        {
+            throw ngraph_error("CPU compilation cancelled");
+        }
         auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
         // with shared pointers, which is fine here but clang doesn't like it.)
         auto handler = GetGlobalBuildDispatcher().find(type_index(typeid(n)));
@@ -1441,27 +1533,29 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
              !cacheable) // Check cacheability only if we are reusing intermediate tensors
             || computes_result(node.get()) || possibly_overwritten(node.get());
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
+        // Staleness flags live in each runtime context, so that contexts executing
+        // concurrently keep their own view of which cached results are still valid.
+        vector<size_t> in_stale, out_stale;
         for (const auto& name : in_names)
         {
             if (tensor_alias.count(name))
             {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                in_stale.emplace_back(get_tensor_stale_index(tensor_alias[name]));
             }
             else
             {
-                in_stale.emplace_back(tensor_stale[name]);
+                in_stale.emplace_back(get_tensor_stale_index(name));
             }
         }
         for (const auto& name : out_names)
         {
             if (tensor_alias.count(name))
             {
-                out_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                out_stale.emplace_back(get_tensor_stale_index(tensor_alias[name]));
             }
             else
             {
-                out_stale.emplace_back(tensor_stale[name]);
+                out_stale.emplace_back(get_tensor_stale_index(name));
             }
         }
 
@@ -1469,9 +1563,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         if (disable_caching)
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                for (auto& stale : out_stale)
+                for (auto stale : out_stale)
                 {
-                    stale.get() = true;
+                    ctx->tensor_stale[stale] = true;
                 }
                 return true;
             };
@@ -1480,17 +1574,17 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
                 bool en = false;
-                for (const auto& stale : in_stale)
+                for (auto stale : in_stale)
                 {
-                    if (stale)
+                    if (ctx->tensor_stale[stale])
                     {
                         en = true;
                         break;
                     }
                 }
-                for (auto& stale : out_stale)
+                for (auto stale : out_stale)
                 {
-                    stale.get() = en;
+                    ctx->tensor_stale[stale] = en;
                 }
                 return en;
             };
@@ -1586,7 +1680,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         for (const auto& p : function_input_index_offset)
         {
             ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
-            get<3>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->tensor_stale[get<3>(p)] = ctx->p_en[get<1>(p)];
         }
 
         for (const auto& p : function_output_index_offset)
@@ -1734,7 +1828,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
-                if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
+                if (enables[ctx->pc](ctx) || ctx->first_iteration)
                 {
                     // Each Op will have exactly one functor, start the clock before the exceution of functor
                     // and collect the profiler_count once the execution complets
@@ -1743,7 +1837,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         start_ts = cpu::Clock::now();
                     }
                     CPUExecutionContext ectx{0};
-                    executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
+                    executor::GetCPUExecutor().execute(functors[ctx->pc], ctx, &ectx);
                     if (ctx->breakpoints.count(ctx->pc + 1))
                     {
                         ctx->pc++;
@@ -1799,6 +1893,264 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
 }
 
+// A saved function holds the graph as the passes left it together with everything build() reads
+// from it besides the graph: op annotations, tensor layouts, pool offsets and the buffer sets.
+// Layouts are written with the raw bytes of their MKLDNN memory descriptor, from which the
+// builders derive the MKLDNN primitive descriptors again.
+void runtime::cpu::CPU_ExternalFunction::save(cpio::Writer& writer)
+{
+    if (!m_is_built || !m_direct_execution)
+    {
+        throw ngraph_error("Only a CPU function built for direct execution can be saved");
+    }
+    if (m_function == nullptr)
+    {
+        throw ngraph_error("CPU function has released its graph and cannot be saved");
+    }
+
+    vector<shared_ptr<Node>> ops = m_function->get_ordered_ops();
+    unordered_map<const Node*, size_t> node_indices;
+    unordered_map<const descriptor::Tensor*, pair<size_t, size_t>> tensor_positions;
+    vector<mkldnn_memory_desc_t> mkldnn_mds;
+    json nodes = json::array();
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        const shared_ptr<Node>& node = ops[i];
+        node_indices[node.get()] = i;
+
+        json node_js;
+        node_js["op"] = serialize_op(*node);
+        json inputs = json::array();
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            const descriptor::Output& output = input.get_output();
+            if (output.get_index() != 0)
+            {
+                throw ngraph_error("Unable to save " + node->get_name() + ", which reads output " +
+                                   to_string(output.get_index()) + " of " +
+                                   output.get_node()->get_name());
+            }
+            inputs.push_back(node_indices.at(output.get_node().get()));
+        }
+        node_js["inputs"] = inputs;
+        json control_deps = json::array();
+        for (const shared_ptr<Node>& dep : node->get_control_dependencies())
+        {
+            control_deps.push_back(node_indices.at(dep.get()));
+        }
+        node_js["control_deps"] = control_deps;
+
+        json outputs = json::array();
+        for (size_t j = 0; j < node->get_output_size(); j++)
+        {
+            descriptor::Tensor& tensor = node->get_output_tensor(j);
+            tensor_positions[&tensor] = make_pair(i, j);
+            auto layout =
+                static_pointer_cast<runtime::cpu::LayoutDescriptor>(tensor.get_tensor_layout());
+            if (layout == nullptr)
+            {
+                throw ngraph_error("layout missing on tensor: " + tensor.get_name());
+            }
+            json output_js;
+            output_js["element_type"] = static_cast<int>(tensor.get_element_type().get_type_enum());
+            output_js["shape"] = tensor.get_shape();
+            output_js["pool_offset"] = tensor.get_pool_offset();
+            output_js["strides"] = layout->get_strides();
+            if (layout->is_mkldnn_layout())
+            {
+                output_js["mkldnn_md"] = mkldnn_mds.size();
+                mkldnn_mds.push_back(layout->get_mkldnn_md().data);
+            }
+            outputs.push_back(output_js);
+        }
+        node_js["outputs"] = outputs;
+
+        if (node->is_op())
+        {
+            auto op_annotations = static_pointer_cast<ngraph::op::Op>(node)->get_op_annotations();
+            if (op_annotations)
+            {
+                json annotations;
+                auto cpu_annotations =
+                    dynamic_pointer_cast<runtime::cpu::CPUOpAnnotations>(op_annotations);
+                annotations["mkldnn_op"] = cpu_annotations && cpu_annotations->is_mkldnn_op();
+                annotations["cacheable"] = op_annotations->is_cacheable();
+                json in_place = json::array();
+                for (auto& oi_pair : op_annotations->get_in_place_oi_pairs())
+                {
+                    in_place.push_back({oi_pair.output, oi_pair.input, oi_pair.destructive});
+                }
+                annotations["in_place"] = in_place;
+                node_js["annotations"] = annotations;
+            }
+        }
+        nodes.push_back(node_js);
+
+        if (node->is_constant())
+        {
+            auto constant = static_pointer_cast<ngraph::op::Constant>(node);
+            writer.write("constant_" + to_string(i),
+                         constant->get_data_ptr(),
+                         static_cast<uint32_t>(shape_size(constant->get_shape()) *
+                                               constant->get_element_type().size()));
+        }
+    }
+
+    json parameters = json::array();
+    for (auto& parameter : m_function->get_parameters())
+    {
+        parameters.push_back(node_indices.at(parameter.get()));
+    }
+    json results = json::array();
+    for (auto& result : m_function->get_results())
+    {
+        results.push_back(node_indices.at(result.get()));
+    }
+    json buffers = json::array();
+    for (auto& buffer : bufferID_to_tensorSets)
+    {
+        json tensors = json::array();
+        for (descriptor::Tensor* tensor : buffer.second.second)
+        {
+            auto it = tensor_positions.find(tensor);
+            if (it == tensor_positions.end())
+            {
+                throw ngraph_error("Memory plan refers to tensor " + tensor->get_name() +
+                                   ", which is not in the compiled graph");
+            }
+            tensors.push_back({it->second.first, it->second.second});
+        }
+        json buffer_js;
+        buffer_js["id"] = buffer.first;
+        buffer_js["role"] = static_cast<int>(buffer.second.first);
+        buffer_js["tensors"] = tensors;
+        buffers.push_back(buffer_js);
+    }
+
+    json graph;
+    graph["name"] = m_function->get_friendly_name();
+    graph["nodes"] = nodes;
+    graph["parameters"] = parameters;
+    graph["results"] = results;
+    graph["temporary_pool_size"] = m_function->get_temporary_pool_size();
+    graph["buffers"] = buffers;
+    string graph_string = graph.dump();
+    writer.write("graph", graph_string.data(), graph_string.size());
+    writer.write("mkldnn_mds",
+                 mkldnn_mds.data(),
+                 static_cast<uint32_t>(mkldnn_mds.size() * sizeof(mkldnn_memory_desc_t)));
+}
+
+shared_ptr<runtime::cpu::CPU_ExternalFunction>
+    runtime::cpu::CPU_ExternalFunction::load(const map<string, string>& entries)
+{
+    json graph = json::parse(entries.at("graph"));
+    const string& mkldnn_mds = entries.at("mkldnn_mds");
+
+    vector<shared_ptr<Node>> nodes;
+    for (json& node_js : graph.at("nodes"))
+    {
+        NodeVector args;
+        for (size_t index : node_js.at("inputs").get<vector<size_t>>())
+        {
+            args.push_back(nodes.at(index));
+        }
+
+        LayoutDescriptorPtrs layouts;
+        vector<size_t> pool_offsets;
+        for (json& output_js : node_js.at("outputs"))
+        {
+            int element_type = output_js.at("element_type").get<int>();
+            descriptor::Tensor tensor(static_cast<element::Type_t>(element_type),
+                                      Shape(output_js.at("shape").get<vector<size_t>>()),
+                                      "");
+            auto layout = make_shared<runtime::cpu::LayoutDescriptor>(tensor);
+            Strides strides(output_js.at("strides").get<vector<size_t>>());
+            layout->set_strides(strides);
+            if (output_js.count("mkldnn_md") != 0)
+            {
+                size_t offset =
+                    output_js.at("mkldnn_md").get<size_t>() * sizeof(mkldnn_memory_desc_t);
+                NGRAPH_CHECK(offset + sizeof(mkldnn_memory_desc_t) <= mkldnn_mds.size(),
+                             "Saved MKLDNN memory descriptor out of range");
+                mkldnn_memory_desc_t md;
+                memcpy(&md, mkldnn_mds.data() + offset, sizeof(md));
+                layout->set_mkldnn_md(mkldnn::memory::desc(md));
+            }
+            layouts.push_back(layout);
+            pool_offsets.push_back(output_js.at("pool_offset").get<size_t>());
+        }
+
+        const void* constant_data = nullptr;
+        auto constant = entries.find("constant_" + to_string(nodes.size()));
+        if (constant != entries.end())
+        {
+            constant_data = constant->second.data();
+        }
+        shared_ptr<Node> node =
+            deserialize_op(node_js.at("op").get<string>(), args, constant_data, layouts);
+        for (size_t index : node_js.at("control_deps").get<vector<size_t>>())
+        {
+            node->add_control_dependency(nodes.at(index));
+        }
+        NGRAPH_CHECK(node->get_output_size() == layouts.size(),
+                     "Saved outputs do not match op ",
+                     node->description());
+        for (size_t i = 0; i < layouts.size(); i++)
+        {
+            node->get_output_tensor(i).set_tensor_layout(layouts[i]);
+            node->get_output_tensor(i).set_pool_offset(pool_offsets[i]);
+        }
+
+        if (node_js.count("annotations") != 0 && node->is_op())
+        {
+            json& annotations = node_js.at("annotations");
+            auto op_annotations = make_shared<runtime::cpu::CPUOpAnnotations>();
+            op_annotations->set_mkldnn_op(annotations.at("mkldnn_op").get<bool>());
+            op_annotations->set_cacheable(annotations.at("cacheable").get<bool>());
+            for (json& oi_pair : annotations.at("in_place"))
+            {
+                op_annotations->add_in_place_oi_pair(
+                    {oi_pair[0].get<size_t>(), oi_pair[1].get<size_t>(), oi_pair[2].get<bool>()});
+            }
+            static_pointer_cast<ngraph::op::Op>(node)->set_op_annotations(op_annotations);
+        }
+        nodes.push_back(node);
+    }
+
+    ParameterVector parameters;
+    for (size_t index : graph.at("parameters").get<vector<size_t>>())
+    {
+        parameters.push_back(static_pointer_cast<ngraph::op::Parameter>(nodes.at(index)));
+    }
+    ResultVector results;
+    for (size_t index : graph.at("results").get<vector<size_t>>())
+    {
+        results.push_back(static_pointer_cast<ngraph::op::Result>(nodes.at(index)));
+    }
+    auto function = make_shared<Function>(results, parameters, graph.at("name").get<string>());
+    // The memory plan is only valid for the order it was made for
+    function->set_ordered_ops(nodes);
+    function->set_temporary_pool_size(graph.at("temporary_pool_size").get<size_t>());
+
+    auto external_function = make_shared<CPU_ExternalFunction>(function, false);
+    external_function->m_is_loaded = true;
+    for (json& buffer_js : graph.at("buffers"))
+    {
+        size_t id = buffer_js.at("id").get<size_t>();
+        auto& buffer = external_function->bufferID_to_tensorSets[id];
+        buffer.first = static_cast<TensorRole>(buffer_js.at("role").get<int>());
+        for (json& position : buffer_js.at("tensors"))
+        {
+            descriptor::Tensor* tensor =
+                &nodes.at(position[0].get<size_t>())->get_output_tensor(position[1].get<size_t>());
+            buffer.second.insert(tensor);
+            external_function->tensor_to_bufferID[tensor] = id;
+        }
+    }
+    return external_function;
+}
+
 size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
     if (tensor_alias.count(name))
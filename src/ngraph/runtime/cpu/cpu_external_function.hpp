@@ -39,6 +39,7 @@
 
 #endif
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -141,6 +142,8 @@ namespace ngraph
                 // return an index into the cpu_runtime_context's buffer_data vector to get the tensor
                 size_t get_buffer_index(const std::string& name);
                 size_t get_buffer_size() const { return m_buffer_size; }
+                // number of staleness flags each cpu_runtime_context needs for caching
+                size_t get_tensor_stale_count() const { return m_tensor_stale_indices.size(); }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -152,12 +155,27 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                /// \brief True when NGRAPH_CPU_DETERMINISTIC_SCATTER is set. Scatter kernels then
+                ///        sum duplicate indices in index order, so results are bitwise
+                ///        reproducible.
+                bool is_deterministic_scatter() const { return m_deterministic_scatter; }
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
 
+                /// \brief Writes the built graph as the passes left it, with the op annotations,
+                ///        tensor layouts including their MKLDNN memory descriptors, pool offsets
+                ///        and buffer sets of the memory plan. Requires a DEX build that kept its
+                ///        graph (release_function false).
+                void save(cpio::Writer& writer);
+
+                /// \brief Recreates a function from the archive entries written by save. Its
+                ///        build runs no passes and no memory planning.
+                static std::shared_ptr<CPU_ExternalFunction>
+                    load(const std::map<std::string, std::string>& entries);
+
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func>& get_halide_functions()
                 {
@@ -194,6 +212,7 @@ namespace ngraph
                                             ngraph::pass::PassConfig& pass_config);
 
                 bool computes_result(Node* node);
+                size_t get_tensor_stale_index(const std::string& name);
                 void release_function() { m_function = nullptr; }
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
@@ -233,8 +252,15 @@ namespace ngraph
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_release_function;
                 bool m_emit_timing;
+                // Only run the passes needed for a runnable graph (tiered compilation)
+                bool m_fast_tier;
+                // Restored by load(), so build() skips the passes
+                bool m_is_loaded;
+                // Abandons the compile between passes and between ops once it returns true
+                std::function<bool()> m_is_cancelled;
 
                 bool m_use_tbb;
+                bool m_deterministic_scatter;
 #if !defined(NGRAPH_DEX_ONLY)
                 bool m_is_compiled;
 #endif
@@ -273,7 +299,8 @@ namespace ngraph
                     executor;
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to get the tensor
                 std::unordered_map<std::string, size_t> m_buffer_indices;
-                std::unordered_map<std::string, bool> tensor_stale;
+                // name of a tensor and index into the cpu_runtime_context's tensor_stale array
+                std::unordered_map<std::string, size_t> m_tensor_stale_indices;
                 // Each tensor is put into one buffer set.
                 // All the tensors in the same buffer set share the same memory buffer.
                 // bufferID_to_tensorSets maps bufferID to the pair of TensorRole and buffer set.
@@ -296,10 +323,9 @@ namespace ngraph
                 // used to get the address at runtime
                 std::list<std::pair<size_t, void*>> constant_tensor_data;
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
-                // input index, offset into the input, and if the input is stale
+                // input index, offset into the input, and index of the input's staleness flag
                 // used to calculate the correct address at runtime
-                std::list<std::tuple<size_t, size_t, size_t, std::reference_wrapper<bool>>>
-                    function_input_index_offset;
+                std::list<std::tuple<size_t, size_t, size_t, size_t>> function_input_index_offset;
                 // index to the cpu_runtime_context's buffer_data vector to get a tensor,
                 // output index, and offset into the output.
                 // used to calculate the correct address at runtime
@@ -0,0 +1,392 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "nlohmann/json.hpp"
+
+#include "ngraph/runtime/cpu/cpu_op_serializer.hpp"
+#include "ngraph/runtime/cpu/op/batch_mat_mul_transpose.hpp"
+#include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
+#include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/deconv.hpp"
+#include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/halide_op.hpp"
+#include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+#include "ngraph/runtime/cpu/op/log_softmax.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
+#include "ngraph/runtime/cpu/op/rnn.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+using json = nlohmann::json;
+
+// ConvolutionRelu, ConvolutionAdd and GroupConvolutionBias share these
+template <typename T>
+static void write_convolution(json& node, const T& op)
+{
+    node["window_movement_strides"] = op.get_window_movement_strides();
+    node["window_dilation_strides"] = op.get_window_dilation_strides();
+    node["padding_below"] = op.get_padding_below();
+    node["padding_above"] = op.get_padding_above();
+    node["data_dilation_strides"] = op.get_data_dilation_strides();
+}
+
+string runtime::cpu::serialize_op(const Node& n)
+{
+    json node;
+    node["cpu_op"] = n.description();
+    if (auto op = dynamic_cast<const ngraph::op::BatchMatMulTranspose*>(&n))
+    {
+        node["transpose_arg0"] = op->get_transpose_arg0();
+        node["transpose_arg1"] = op->get_transpose_arg1();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::BatchNormTrainingRelu*>(&n))
+    {
+        node["eps"] = op->get_eps_value();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::BatchNormInferenceRelu*>(&n))
+    {
+        node["eps"] = op->get_eps_value();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::BoundedRelu*>(&n))
+    {
+        node["alpha"] = op->get_alpha();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::ConvolutionAdd*>(&n))
+    {
+        write_convolution(node, *op);
+        node["with_relu"] = op->with_relu();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::ConvolutionRelu*>(&n))
+    {
+        write_convolution(node, *op);
+    }
+    else if (auto op = dynamic_cast<const runtime::cpu::op::ConvertLayout*>(&n))
+    {
+        node["arg_output_index"] = op->get_arg_output_index();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::DeconvolutionBias*>(&n))
+    {
+        node["data_batch_shape"] = op->get_data_batch_shape();
+        node["window_movement_strides"] = op->get_window_movement_strides_forward();
+        node["window_dilation_strides"] = op->get_window_dilation_strides_forward();
+        node["padding_below"] = op->get_padding_below_forward();
+        node["padding_above"] = op->get_padding_above_forward();
+        node["data_dilation_strides"] = op->get_data_dilation_strides_forward();
+        node["with_relu"] = op->with_relu();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::GroupConvolutionBias*>(&n))
+    {
+        write_convolution(node, *op);
+        node["groups"] = op->get_groups();
+        node["output_shape"] = op->get_output_shape(0);
+        node["with_relu"] = op->with_relu();
+        node["alpha"] = op->get_alpha();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::CPULeakyRelu*>(&n))
+    {
+        node["alpha"] = op->get_alpha();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::CPULogSoftmax*>(&n))
+    {
+        node["axes"] = op->get_axes();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::Lstm*>(&n))
+    {
+        node["rnn_type"] = static_cast<int>(op->get_rnn_type());
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::MatmulBias*>(&n))
+    {
+        node["shape_w"] = op->get_a_shape();
+        node["shape_x"] = op->get_b_shape();
+        node["transpose_w"] = op->get_is_a_transposed();
+        node["transpose_x"] = op->get_is_b_transposed();
+        node["broadcast_axes"] = op->get_broadcast_axes();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::MaxPoolWithIndices*>(&n))
+    {
+        node["window_shape"] = op->get_window_shape();
+        node["window_movement_strides"] = op->get_window_movement_strides();
+        node["padding_below"] = op->get_padding_below();
+        node["padding_above"] = op->get_padding_above();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::MaxPoolWithIndicesBackprop*>(&n))
+    {
+        node["window_shape"] = op->get_window_shape();
+        node["window_movement_strides"] = op->get_window_movement_strides();
+        node["padding_below"] = op->get_padding_below();
+        node["padding_above"] = op->get_padding_above();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::QuantizedMatmul*>(&n))
+    {
+        node["requantize"] = op->requantize();
+        node["with_relu"] = op->with_relu();
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::Rnn*>(&n))
+    {
+        node["num_timesteps"] = op->get_num_timesteps();
+        node["num_gates_per_cell"] = op->get_gates_per_cell();
+        node["src_sequence_length"] = op->get_src_sequence_length();
+        node["num_cell_states"] = op->get_num_cell_states();
+        node["direction"] = op->get_direction();
+        node["num_fused_layers"] = op->get_num_fused_layers();
+        node["rnn_type"] = static_cast<int>(op->get_rnn_type());
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::SigmoidMultiply*>(&n))
+    {
+        node["input_0_type"] = static_cast<int>(op->get_input_func_type(0));
+        node["input_1_type"] = static_cast<int>(op->get_input_func_type(1));
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::SigmoidMultiplyBackprop*>(&n))
+    {
+        node["input_0_type"] = static_cast<int>(op->get_input_func_type(0));
+        node["input_1_type"] = static_cast<int>(op->get_input_func_type(1));
+    }
+    else if (auto op = dynamic_cast<const ngraph::op::UpdateSlice*>(&n))
+    {
+        node["lower_bounds"] = op->get_lower_bounds();
+        node["upper_bounds"] = op->get_upper_bounds();
+        node["strides"] = op->get_strides();
+    }
+    else if (dynamic_cast<const runtime::cpu::op::LoopKernel*>(&n) ||
+             dynamic_cast<const runtime::cpu::op::HalideOp*>(&n))
+    {
+        throw ngraph_error("Unable to serialize op " + n.description());
+    }
+    else
+    {
+        return serialize_attributes(n);
+    }
+    return node.dump();
+}
+
+shared_ptr<Node> runtime::cpu::deserialize_op(const string& attributes,
+                                              const NodeVector& args,
+                                              const void* constant_data,
+                                              const LayoutDescriptorPtrs& output_layouts)
+{
+    json node_js = json::parse(attributes);
+    if (node_js.count("cpu_op") == 0)
+    {
+        return deserialize_node(attributes, args, constant_data);
+    }
+
+    string op_name = node_js.at("cpu_op").get<string>();
+    auto get_strides = [&node_js](const string& key) {
+        return Strides(node_js.at(key).get<vector<size_t>>());
+    };
+    auto get_padding = [&node_js](const string& key) {
+        return CoordinateDiff(node_js.at(key).get<vector<ptrdiff_t>>());
+    };
+    auto get_shape = [&node_js](const string& key) {
+        return Shape(node_js.at(key).get<vector<size_t>>());
+    };
+    using FunctionType = ngraph::op::SigmoidMultiply::FunctionType;
+
+    shared_ptr<Node> node;
+    if (op_name == "BatchMatMulTranspose")
+    {
+        node = make_shared<ngraph::op::BatchMatMulTranspose>(
+            args.at(0),
+            args.at(1),
+            node_js.at("transpose_arg0").get<bool>(),
+            node_js.at("transpose_arg1").get<bool>());
+    }
+    else if (op_name == "BatchNormTrainingRelu")
+    {
+        node = make_shared<ngraph::op::BatchNormTrainingRelu>(
+            node_js.at("eps").get<double>(), args.at(0), args.at(1), args.at(2));
+    }
+    else if (op_name == "BatchNormInferenceRelu")
+    {
+        node = make_shared<ngraph::op::BatchNormInferenceRelu>(node_js.at("eps").get<double>(),
+                                                               args.at(0),
+                                                               args.at(1),
+                                                               args.at(2),
+                                                               args.at(3),
+                                                               args.at(4));
+    }
+    else if (op_name == "BoundedRelu")
+    {
+        node = make_shared<ngraph::op::BoundedRelu>(args.at(0), node_js.at("alpha").get<float>());
+    }
+    else if (op_name == "ConvolutionAdd")
+    {
+        node = make_shared<ngraph::op::ConvolutionAdd>(args.at(0),
+                                                       args.at(1),
+                                                       args.at(2),
+                                                       get_strides("window_movement_strides"),
+                                                       get_strides("window_dilation_strides"),
+                                                       get_padding("padding_below"),
+                                                       get_padding("padding_above"),
+                                                       get_strides("data_dilation_strides"),
+                                                       node_js.at("with_relu").get<bool>());
+    }
+    else if (op_name == "ConvolutionRelu")
+    {
+        node = make_shared<ngraph::op::ConvolutionRelu>(args.at(0),
+                                                        args.at(1),
+                                                        get_strides("window_movement_strides"),
+                                                        get_strides("window_dilation_strides"),
+                                                        get_padding("padding_below"),
+                                                        get_padding("padding_above"),
+                                                        get_strides("data_dilation_strides"));
+    }
+    else if (op_name == "ConvertLayout")
+    {
+        node = make_shared<runtime::cpu::op::ConvertLayout>(
+            args.at(0), node_js.at("arg_output_index").get<size_t>(), output_layouts.at(0));
+    }
+    else if (op_name == "DeconvolutionBias")
+    {
+        node = make_shared<ngraph::op::DeconvolutionBias>(get_shape("data_batch_shape"),
+                                                          args.at(0),
+                                                          args.at(1),
+                                                          args.at(2),
+                                                          get_strides("window_movement_strides"),
+                                                          get_strides("window_dilation_strides"),
+                                                          get_padding("padding_below"),
+                                                          get_padding("padding_above"),
+                                                          get_strides("data_dilation_strides"),
+                                                          node_js.at("with_relu").get<bool>());
+    }
+    else if (op_name == "GroupConvolutionBias")
+    {
+        node = make_shared<ngraph::op::GroupConvolutionBias>(args.at(0),
+                                                             args.at(1),
+                                                             args.at(2),
+                                                             get_strides("window_movement_strides"),
+                                                             get_strides("window_dilation_strides"),
+                                                             get_padding("padding_below"),
+                                                             get_padding("padding_above"),
+                                                             get_strides("data_dilation_strides"),
+                                                             node_js.at("groups").get<size_t>(),
+                                                             get_shape("output_shape"),
+                                                             node_js.at("with_relu").get<bool>(),
+                                                             node_js.at("alpha").get<float>());
+    }
+    else if (op_name == "CPULeakyRelu")
+    {
+        node = make_shared<ngraph::op::CPULeakyRelu>(args.at(0), node_js.at("alpha").get<float>());
+    }
+    else if (op_name == "CPULogSoftmax")
+    {
+        node = make_shared<ngraph::op::CPULogSoftmax>(
+            args.at(0), AxisSet(node_js.at("axes").get<set<size_t>>()));
+    }
+    else if (op_name == "Lstm")
+    {
+        auto rnn_type =
+            static_cast<runtime::cpu::rnn_utils::rnntype>(node_js.at("rnn_type").get<int>());
+        node = make_shared<ngraph::op::Lstm>(
+            args.at(0), args.at(1), args.at(2), args.at(3), args.at(4), rnn_type);
+    }
+    else if (op_name == "MatmulBias")
+    {
+        node = make_shared<ngraph::op::MatmulBias>(
+            args.at(0),
+            args.at(1),
+            args.size() == 3 ? args.at(2) : nullptr,
+            get_shape("shape_w"),
+            get_shape("shape_x"),
+            node_js.at("transpose_w").get<bool>(),
+            node_js.at("transpose_x").get<bool>(),
+            AxisSet(node_js.at("broadcast_axes").get<set<size_t>>()));
+    }
+    else if (op_name == "MaxPoolWithIndices")
+    {
+        node = make_shared<ngraph::op::MaxPoolWithIndices>(args.at(0),
+                                                           get_shape("window_shape"),
+                                                           get_strides("window_movement_strides"),
+                                                           get_shape("padding_below"),
+                                                           get_shape("padding_above"));
+    }
+    else if (op_name == "MaxPoolWithIndicesBackprop")
+    {
+        node = make_shared<ngraph::op::MaxPoolWithIndicesBackprop>(
+            args.at(0),
+            args.at(1),
+            args.at(2),
+            get_shape("window_shape"),
+            get_strides("window_movement_strides"),
+            get_shape("padding_below"),
+            get_shape("padding_above"));
+    }
+    else if (op_name == "QuantizedMatmul")
+    {
+        node = make_shared<ngraph::op::QuantizedMatmul>(args.at(0),
+                                                        args.at(1),
+                                                        args.at(2),
+                                                        node_js.at("requantize").get<bool>(),
+                                                        node_js.at("with_relu").get<bool>());
+    }
+    else if (op_name == "Rnn")
+    {
+        auto rnn_type =
+            static_cast<runtime::cpu::rnn_utils::rnntype>(node_js.at("rnn_type").get<int>());
+        node = make_shared<ngraph::op::Rnn>(args.at(0),
+                                            args.at(1),
+                                            args.at(2),
+                                            args.at(3),
+                                            args.at(4),
+                                            node_js.at("num_timesteps").get<size_t>(),
+                                            node_js.at("num_gates_per_cell").get<size_t>(),
+                                            node_js.at("src_sequence_length").get<size_t>(),
+                                            node_js.at("num_cell_states").get<size_t>(),
+                                            node_js.at("direction").get<size_t>(),
+                                            node_js.at("num_fused_layers").get<size_t>(),
+                                            rnn_type);
+    }
+    else if (op_name == "SigmoidMultiply")
+    {
+        node = make_shared<ngraph::op::SigmoidMultiply>(
+            args.at(0),
+            args.at(1),
+            static_cast<FunctionType>(node_js.at("input_0_type").get<int>()),
+            static_cast<FunctionType>(node_js.at("input_1_type").get<int>()));
+    }
+    else if (op_name == "SigmoidMultiplyBackprop")
+    {
+        array<FunctionType, 2> input_type{
+            {static_cast<FunctionType>(node_js.at("input_0_type").get<int>()),
+             static_cast<FunctionType>(node_js.at("input_1_type").get<int>())}};
+        node = make_shared<ngraph::op::SigmoidMultiplyBackprop>(
+            args.at(0), args.at(1), args.at(2), input_type);
+    }
+    else if (op_name == "UpdateSlice")
+    {
+        node = make_shared<ngraph::op::UpdateSlice>(
+            args.at(0),
+            args.at(1),
+            Coordinate(node_js.at("lower_bounds").get<vector<size_t>>()),
+            Coordinate(node_js.at("upper_bounds").get<vector<size_t>>()),
+            get_strides("strides"));
+    }
+    else
+    {
+        throw ngraph_error("Unable to deserialize CPU op " + op_name);
+    }
+    return node;
+}
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Serialize the attributes of an op in a graph compiled by the CPU backend.
+            ///        The CPU specific ops are written here, all others by
+            ///        ngraph::serialize_attributes.
+            /// \throws ngraph_error for ops holding a subgraph, such as LoopKernel
+            std::string serialize_op(const Node& node);
+
+            /// \brief Recreate an op written by serialize_op
+            /// \param attributes The json string returned by serialize_op
+            /// \param args The arguments of the new op
+            /// \param constant_data The values of a Constant
+            /// \param output_layouts The layouts of the new op's outputs
+            std::shared_ptr<Node> deserialize_op(const std::string& attributes,
+                                                 const NodeVector& args,
+                                                 const void* constant_data,
+                                                 const LayoutDescriptorPtrs& output_layouts);
+        }
+    }
+}
@@ -56,6 +56,9 @@ namespace ngraph
             {
                 int64_t* op_durations;
                 bool* p_en;
+                // staleness of the tensors computed in this context, used to skip
+                // recomputation of cacheable ops whose inputs did not change
+                bool* tensor_stale;
                 bool first_iteration;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
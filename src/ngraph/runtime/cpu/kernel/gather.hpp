@@ -0,0 +1,240 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include <string>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Rows this far ahead of the one being copied are prefetched
+                static const Eigen::Index gather_prefetch_distance = 4;
+
+                inline void gather_prefetch(const void* address)
+                {
+#if defined(__GNUC__)
+                    __builtin_prefetch(address, 0, 1);
+#endif
+                }
+
+                // Validates every index against [0, bound) once, before any row is copied
+                template <typename U>
+                void check_gather_indices(const U* indices,
+                                          size_t count,
+                                          size_t bound,
+                                          const std::string& op_name)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        if (indices[i] < 0 || static_cast<size_t>(indices[i]) >= bound)
+                        {
+                            throw ngraph_error(op_name + " index " + std::to_string(indices[i]) +
+                                               " is out of range [0, " + std::to_string(bound) +
+                                               ")");
+                        }
+                    }
+                }
+
+                // Copies rows of `row` elements. Output row t is taken from row
+                // (t / num_indices) * axis_len + indices[t % num_indices] of params, which
+                // covers Gather (outer > 1) and EmbeddingLookup (outer == 1). Rows are
+                // partitioned across the threads of the arena. T is only a storage type,
+                // callers dispatch on the element size.
+                template <typename T, typename U>
+                void gather_rows(const T* params,
+                                 const U* indices,
+                                 T* out,
+                                 size_t outer,
+                                 size_t axis_len,
+                                 size_t num_indices,
+                                 size_t row,
+                                 int arena)
+                {
+                    Eigen::Index total = static_cast<Eigen::Index>(outer * num_indices);
+                    if (total == 0 || row == 0)
+                    {
+                        return;
+                    }
+
+                    auto source = [&](Eigen::Index t) {
+                        size_t o = static_cast<size_t>(t) / num_indices;
+                        size_t j = static_cast<size_t>(t) % num_indices;
+                        return params + (o * axis_len + static_cast<size_t>(indices[j])) * row;
+                    };
+
+                    auto block = [&](Eigen::Index begin, Eigen::Index end) {
+                        if (row == 1)
+                        {
+                            for (Eigen::Index t = begin; t < end; t++)
+                            {
+                                out[t] = *source(t);
+                            }
+                            return;
+                        }
+                        for (Eigen::Index t = begin; t < end; t++)
+                        {
+                            if (t + gather_prefetch_distance < end)
+                            {
+                                gather_prefetch(source(t + gather_prefetch_distance));
+                            }
+                            memcpy(out + t * row, source(t), row * sizeof(T));
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(static_cast<double>(row * sizeof(T)),
+                                             static_cast<double>(row * sizeof(T)),
+                                             1.0);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        total, cost, block);
+                }
+
+                template <typename T, typename U>
+                void gather(void* params,
+                            void* indices,
+                            void* out,
+                            const Shape& params_shape,
+                            const Shape& indices_shape,
+                            size_t axis,
+                            int arena)
+                {
+                    size_t outer = 1;
+                    size_t row = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= params_shape[i];
+                    }
+                    for (size_t i = axis + 1; i < params_shape.size(); i++)
+                    {
+                        row *= params_shape[i];
+                    }
+                    size_t num_indices = shape_size(indices_shape);
+
+                    check_gather_indices(
+                        static_cast<U*>(indices), num_indices, params_shape[axis], "Gather");
+                    gather_rows(static_cast<T*>(params),
+                                static_cast<U*>(indices),
+                                static_cast<T*>(out),
+                                outer,
+                                params_shape[axis],
+                                num_indices,
+                                row,
+                                arena);
+                }
+
+                template <typename T, typename U>
+                void gather_nd(void* params,
+                               void* indices,
+                               void* out,
+                               const Shape& params_shape,
+                               const Shape& indices_shape,
+                               int arena)
+                {
+                    const T* in = static_cast<T*>(params);
+                    const U* idx = static_cast<U*>(indices);
+                    T* dst = static_cast<T*>(out);
+
+                    size_t slice_rank = indices_shape.back();
+                    size_t leaves = shape_size(indices_shape) / slice_rank;
+                    size_t row = 1;
+                    for (size_t i = slice_rank; i < params_shape.size(); i++)
+                    {
+                        row *= params_shape[i];
+                    }
+                    Strides params_strides = row_major_strides(params_shape);
+
+                    for (size_t i = 0; i < leaves; i++)
+                    {
+                        for (size_t j = 0; j < slice_rank; j++)
+                        {
+                            check_gather_indices(
+                                &idx[i * slice_rank + j], 1, params_shape[j], "GatherND");
+                        }
+                    }
+
+                    Eigen::Index total = static_cast<Eigen::Index>(leaves);
+                    if (total == 0 || row == 0)
+                    {
+                        return;
+                    }
+
+                    auto source = [&](Eigen::Index t) {
+                        size_t offset = 0;
+                        for (size_t j = 0; j < slice_rank; j++)
+                        {
+                            offset += static_cast<size_t>(idx[t * slice_rank + j]) *
+                                      params_strides[j];
+                        }
+                        return in + offset;
+                    };
+
+                    auto block = [&](Eigen::Index begin, Eigen::Index end) {
+                        for (Eigen::Index t = begin; t < end; t++)
+                        {
+                            if (t + gather_prefetch_distance < end)
+                            {
+                                gather_prefetch(source(t + gather_prefetch_distance));
+                            }
+                            memcpy(dst + t * row, source(t), row * sizeof(T));
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(static_cast<double>(row * sizeof(T)),
+                                             static_cast<double>(row * sizeof(T)),
+                                             static_cast<double>(slice_rank));
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        total, cost, block);
+                }
+
+                template <typename T, typename U>
+                void embedding(void* indices,
+                               void* weights,
+                               void* out,
+                               size_t indices_count,
+                               const Shape& weights_shape,
+                               int arena)
+                {
+                    check_gather_indices(static_cast<U*>(indices),
+                                         indices_count,
+                                         weights_shape.at(0),
+                                         "EmbeddingLookup");
+                    gather_rows(static_cast<T*>(weights),
+                                static_cast<U*>(indices),
+                                static_cast<T*>(out),
+                                1,
+                                weights_shape.at(0),
+                                indices_count,
+                                weights_shape.at(1),
+                                arena);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,257 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Elements evaluated per tile. All registers of a tile are this long, so the
+                // temporaries of a fused kernel stay in cache between instructions.
+                static const size_t loop_kernel_tile = 1024;
+
+                enum class LoopKernelOpcode
+                {
+                    Abs,
+                    Add,
+                    Copy,
+                    Divide,
+                    Exp,
+                    Log,
+                    Maximum,
+                    Minimum,
+                    Multiply,
+                    Negative,
+                    Relu,
+                    Sigmoid,
+                    Sqrt,
+                    Subtract,
+                    Tanh
+                };
+
+                // Operands and results name registers. Unary instructions repeat arg0 as arg1.
+                struct LoopKernelInstruction
+                {
+                    LoopKernelOpcode opcode;
+                    size_t result;
+                    size_t arg0;
+                    size_t arg1;
+                };
+
+                // Kernel argument `arg`, read with `strides` in the coordinate space of the
+                // output. A zero stride broadcasts the argument along that axis. Contiguous
+                // arguments are read in place instead of being copied into their register.
+                struct LoopKernelInput
+                {
+                    size_t arg;
+                    Strides strides;
+                    bool contiguous;
+                };
+
+                // A fused elementwise DAG over tensors of `shape`. Registers are laid out as
+                // [inputs | scratch | outputs]: register j < inputs.size() holds inputs[j],
+                // the next num_scratch registers hold temporaries, and the remaining
+                // registers alias the kernel outputs in order.
+                struct LoopKernelProgram
+                {
+                    Shape shape;
+                    std::vector<LoopKernelInput> inputs;
+                    std::vector<LoopKernelInstruction> instructions;
+                    size_t num_scratch;
+                };
+
+                // Gathers elements [begin, begin + count) of the output index space from a
+                // strided (possibly broadcast) input
+                template <typename T>
+                void loop_kernel_load(const T* in,
+                                      const Strides& strides,
+                                      const Shape& shape,
+                                      size_t begin,
+                                      size_t count,
+                                      T* out)
+                {
+                    size_t rank = shape.size();
+                    if (rank == 0)
+                    {
+                        std::fill(out, out + count, in[0]);
+                        return;
+                    }
+
+                    std::vector<size_t> coordinate(rank);
+                    size_t offset = 0;
+                    size_t remainder = begin;
+                    for (size_t d = rank; d-- > 0;)
+                    {
+                        coordinate[d] = remainder % shape[d];
+                        remainder /= shape[d];
+                        offset += coordinate[d] * strides[d];
+                    }
+
+                    size_t inner = shape[rank - 1];
+                    size_t inner_stride = strides[rank - 1];
+                    for (size_t i = 0; i < count;)
+                    {
+                        // Copy the rest of the current innermost row, then carry
+                        size_t run = std::min(inner - coordinate[rank - 1], count - i);
+                        if (inner_stride == 0)
+                        {
+                            std::fill(out + i, out + i + run, in[offset]);
+                        }
+                        else
+                        {
+                            for (size_t j = 0; j < run; j++)
+                            {
+                                out[i + j] = in[offset + j * inner_stride];
+                            }
+                        }
+                        i += run;
+                        offset += run * inner_stride;
+                        coordinate[rank - 1] += run;
+                        for (size_t d = rank - 1; d > 0 && coordinate[d] == shape[d]; d--)
+                        {
+                            offset -= coordinate[d] * strides[d];
+                            coordinate[d] = 0;
+                            coordinate[d - 1]++;
+                            offset += strides[d - 1];
+                        }
+                    }
+                }
+
+                template <typename T>
+                void loop_kernel_apply(
+                    LoopKernelOpcode opcode, T* result, const T* arg0, const T* arg1, size_t count)
+                {
+                    using Array = Eigen::Array<T, Eigen::Dynamic, 1>;
+                    Eigen::Map<Array> r(result, count);
+                    Eigen::Map<const Array> a(arg0, count);
+                    Eigen::Map<const Array> b(arg1, count);
+
+                    switch (opcode)
+                    {
+                    case LoopKernelOpcode::Abs: r = a.abs(); break;
+                    case LoopKernelOpcode::Add: r = a + b; break;
+                    case LoopKernelOpcode::Copy: r = a; break;
+                    case LoopKernelOpcode::Divide: r = a / b; break;
+                    case LoopKernelOpcode::Exp: r = a.exp(); break;
+                    case LoopKernelOpcode::Log: r = a.log(); break;
+                    case LoopKernelOpcode::Maximum: r = a.max(b); break;
+                    case LoopKernelOpcode::Minimum: r = a.min(b); break;
+                    case LoopKernelOpcode::Multiply: r = a * b; break;
+                    case LoopKernelOpcode::Negative: r = -a; break;
+                    case LoopKernelOpcode::Relu: r = a.max(T(0)); break;
+                    case LoopKernelOpcode::Sigmoid: r = (T(1) + (-a).exp()).inverse(); break;
+                    case LoopKernelOpcode::Sqrt: r = a.sqrt(); break;
+                    case LoopKernelOpcode::Subtract: r = a - b; break;
+                    case LoopKernelOpcode::Tanh: r = a.tanh(); break;
+                    }
+                }
+
+                // Evaluates the program one tile at a time, so each input element is read
+                // and each output element written exactly once however deep the fused
+                // chain is. Tiles are partitioned across the threads of the arena.
+                template <typename T>
+                void loop_kernel(const LoopKernelProgram& program,
+                                 const std::vector<void*>& inputs,
+                                 const std::vector<void*>& outputs,
+                                 int arena)
+                {
+                    size_t count = shape_size(program.shape);
+                    if (count == 0)
+                    {
+                        return;
+                    }
+
+                    size_t num_inputs = program.inputs.size();
+                    size_t num_buffers = num_inputs + program.num_scratch;
+                    size_t num_registers = num_buffers + outputs.size();
+
+                    auto block = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<T> buffers(num_buffers * loop_kernel_tile);
+                        std::vector<T*> registers(num_registers);
+                        for (size_t j = 0; j < num_buffers; j++)
+                        {
+                            registers[j] = buffers.data() + j * loop_kernel_tile;
+                        }
+
+                        for (Eigen::Index t = first; t < last; t++)
+                        {
+                            size_t begin = static_cast<size_t>(t) * loop_kernel_tile;
+                            size_t len = std::min(loop_kernel_tile, count - begin);
+
+                            for (size_t j = 0; j < num_inputs; j++)
+                            {
+                                const LoopKernelInput& input = program.inputs[j];
+                                T* src = static_cast<T*>(inputs[input.arg]);
+                                if (input.contiguous)
+                                {
+                                    registers[j] = src + begin;
+                                }
+                                else
+                                {
+                                    registers[j] = buffers.data() + j * loop_kernel_tile;
+                                    loop_kernel_load(src,
+                                                     input.strides,
+                                                     program.shape,
+                                                     begin,
+                                                     len,
+                                                     registers[j]);
+                                }
+                            }
+                            for (size_t i = 0; i < outputs.size(); i++)
+                            {
+                                registers[num_buffers + i] = static_cast<T*>(outputs[i]) + begin;
+                            }
+
+                            for (const LoopKernelInstruction& instruction : program.instructions)
+                            {
+                                loop_kernel_apply(instruction.opcode,
+                                                  registers[instruction.result],
+                                                  registers[instruction.arg0],
+                                                  registers[instruction.arg1],
+                                                  len);
+                            }
+                        }
+                    };
+
+                    double tile_bytes = static_cast<double>(loop_kernel_tile * sizeof(T));
+                    Eigen::TensorOpCost cost(num_inputs * tile_bytes,
+                                             outputs.size() * tile_bytes,
+                                             static_cast<double>(program.instructions.size() *
+                                                                 loop_kernel_tile));
+                    Eigen::Index tiles = static_cast<Eigen::Index>(
+                        (count + loop_kernel_tile - 1) / loop_kernel_tile);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        tiles, cost, block);
+                }
+            }
+        }
+    }
+}
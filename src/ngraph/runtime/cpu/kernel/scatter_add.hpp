@@ -0,0 +1,262 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Rows receiving more updates than this are summed in chunks of this size
+                // on different threads, unless the caller asks for deterministic results.
+                static const size_t scatter_add_hot_row_chunk = 64;
+
+                template <typename U>
+                size_t scatter_row_index(U index, size_t bound, const std::string& op_name)
+                {
+                    if (index < 0 || static_cast<size_t>(index) >= bound)
+                    {
+                        throw ngraph_error(op_name + " index " + std::to_string(index) +
+                                           " is out of range [0, " + std::to_string(bound) + ")");
+                    }
+                    return static_cast<size_t>(index);
+                }
+
+                // Adds update row t (row_len elements at updates + t * row_len) into output
+                // row dest[t], without atomics. The updates are ordered by destination so each
+                // output row is owned by exactly one task. With deterministic set, every row
+                // accumulates its updates in index order, exactly as a serial loop would.
+                // Otherwise rows with many duplicates are split into chunks that are summed
+                // concurrently and then reduced in chunk order, which reassociates the sum.
+                template <typename T>
+                void scatter_add_rows(T* out,
+                                      const T* updates,
+                                      const std::vector<size_t>& dest,
+                                      size_t row_len,
+                                      bool deterministic,
+                                      int arena)
+                {
+                    size_t n = dest.size();
+                    if (n == 0 || row_len == 0)
+                    {
+                        return;
+                    }
+
+                    std::vector<size_t> order(n);
+                    std::iota(order.begin(), order.end(), 0);
+                    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                        return dest[a] < dest[b];
+                    });
+
+                    // A work item adds order[begin, end) either into output row `row` or, for
+                    // a chunk of a hot row, into zeroed partial row `partial`.
+                    const size_t direct = static_cast<size_t>(-1);
+                    struct WorkItem
+                    {
+                        size_t begin;
+                        size_t end;
+                        size_t row;
+                        size_t partial;
+                    };
+                    struct HotRow
+                    {
+                        size_t row;
+                        size_t first_partial;
+                        size_t num_partials;
+                    };
+                    std::vector<WorkItem> items;
+                    std::vector<HotRow> hot_rows;
+                    size_t num_partials = 0;
+                    for (size_t begin = 0; begin < n;)
+                    {
+                        size_t row = dest[order[begin]];
+                        size_t end = begin + 1;
+                        while (end < n && dest[order[end]] == row)
+                        {
+                            end++;
+                        }
+                        if (deterministic || end - begin <= scatter_add_hot_row_chunk)
+                        {
+                            items.push_back({begin, end, row, direct});
+                        }
+                        else
+                        {
+                            hot_rows.push_back({row, num_partials, 0});
+                            for (size_t chunk = begin; chunk < end;
+                                 chunk += scatter_add_hot_row_chunk)
+                            {
+                                items.push_back(
+                                    {chunk,
+                                     std::min(chunk + scatter_add_hot_row_chunk, end),
+                                     row,
+                                     num_partials++});
+                                hot_rows.back().num_partials++;
+                            }
+                        }
+                        begin = end;
+                    }
+                    std::vector<T> partials(num_partials * row_len, T(0));
+
+                    auto accumulate = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            const WorkItem& item = items[i];
+                            T* target = item.partial == direct
+                                            ? out + item.row * row_len
+                                            : partials.data() + item.partial * row_len;
+                            for (size_t u = item.begin; u < item.end; u++)
+                            {
+                                const T* src = updates + order[u] * row_len;
+                                for (size_t c = 0; c < row_len; c++)
+                                {
+                                    target[c] += src[c];
+                                }
+                            }
+                        }
+                    };
+
+                    auto reduce_hot_rows = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            const HotRow& hot = hot_rows[i];
+                            T* target = out + hot.row * row_len;
+                            for (size_t p = 0; p < hot.num_partials; p++)
+                            {
+                                const T* src = partials.data() + (hot.first_partial + p) * row_len;
+                                for (size_t c = 0; c < row_len; c++)
+                                {
+                                    target[c] += src[c];
+                                }
+                            }
+                        }
+                    };
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    double row_bytes = static_cast<double>(row_len * sizeof(T));
+                    double avg_updates = static_cast<double>(n) / items.size();
+                    device.parallelFor(static_cast<Eigen::Index>(items.size()),
+                                       Eigen::TensorOpCost(avg_updates * row_bytes,
+                                                           row_bytes,
+                                                           avg_updates * row_len),
+                                       accumulate);
+                    if (!hot_rows.empty())
+                    {
+                        double chunk_bytes = row_bytes * scatter_add_hot_row_chunk;
+                        device.parallelFor(static_cast<Eigen::Index>(hot_rows.size()),
+                                           Eigen::TensorOpCost(chunk_bytes, row_bytes, 0),
+                                           reduce_hot_rows);
+                    }
+                }
+
+                template <typename T, typename U>
+                void scatter_add(void* inputs,
+                                 void* indices,
+                                 void* updates,
+                                 void* out,
+                                 const Shape& inputs_shape,
+                                 const Shape& indices_shape,
+                                 bool deterministic,
+                                 int arena)
+                {
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    if (out != inputs)
+                    {
+                        device.memcpy(out, inputs, sizeof(T) * shape_size(inputs_shape));
+                    }
+
+                    size_t rows = inputs_shape.at(0);
+                    size_t row_len = rows == 0 ? 0 : shape_size(inputs_shape) / rows;
+                    const U* idx = static_cast<U*>(indices);
+                    std::vector<size_t> dest(shape_size(indices_shape));
+                    for (size_t t = 0; t < dest.size(); t++)
+                    {
+                        dest[t] = scatter_row_index(idx[t], rows, "ScatterAdd");
+                    }
+                    scatter_add_rows(static_cast<T*>(out),
+                                     static_cast<T*>(updates),
+                                     dest,
+                                     row_len,
+                                     deterministic,
+                                     arena);
+                }
+
+                template <typename T, typename U>
+                void scatter_nd_add(void* inputs,
+                                    void* indices,
+                                    void* updates,
+                                    void* out,
+                                    const Shape& inputs_shape,
+                                    const Shape& indices_shape,
+                                    bool deterministic,
+                                    int arena)
+                {
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    if (out != inputs)
+                    {
+                        device.memcpy(out, inputs, sizeof(T) * shape_size(inputs_shape));
+                    }
+
+                    // Each index vector selects one row of the inputs viewed as
+                    // [inputs_shape[0] * ... * inputs_shape[slice_rank - 1], row_len]
+                    size_t slice_rank = indices_shape.back();
+                    size_t row_len = 1;
+                    for (size_t i = slice_rank; i < inputs_shape.size(); i++)
+                    {
+                        row_len *= inputs_shape[i];
+                    }
+                    const U* idx = static_cast<U*>(indices);
+                    std::vector<size_t> dest(shape_size(indices_shape) / slice_rank);
+                    for (size_t t = 0; t < dest.size(); t++)
+                    {
+                        size_t row = 0;
+                        for (size_t j = 0; j < slice_rank; j++)
+                        {
+                            row = row * inputs_shape[j] +
+                                  scatter_row_index(
+                                      idx[t * slice_rank + j], inputs_shape[j], "ScatterNDAdd");
+                        }
+                        dest[t] = row;
+                    }
+                    scatter_add_rows(static_cast<T*>(out),
+                                     static_cast<T*>(updates),
+                                     dest,
+                                     row_len,
+                                     deterministic,
+                                     arena);
+                }
+            }
+        }
+    }
+}
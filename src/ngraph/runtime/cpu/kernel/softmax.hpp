@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -164,6 +168,262 @@ namespace ngraph
                 {
                     softmax<ElementType, 4, 3>(input, output, input_shape, softmax_axes, arena);
                 }
+
+                // Accumulation type of the native softmax kernels; half precision inputs are
+                // widened to float.
+                template <typename ElementType>
+                struct softmax_accumulator
+                {
+                    using type = float;
+                };
+
+                template <>
+                struct softmax_accumulator<double>
+                {
+                    using type = double;
+                };
+
+                // Number of contiguous elements a softmax task keeps running statistics for
+                static const size_t softmax_lanes = 16;
+
+                // Returns true if the axes form one contiguous range, so the input can be
+                // viewed as [outer, reduced, inner].
+                inline bool softmax_axes_contiguous(const AxisSet& axes)
+                {
+                    return !axes.empty() && *axes.rbegin() - *axes.begin() + 1 == axes.size();
+                }
+
+                // Collapses a shape around a contiguous range of softmax axes
+                inline void softmax_view(const Shape& input_shape,
+                                         const AxisSet& softmax_axes,
+                                         size_t& outer,
+                                         size_t& n,
+                                         size_t& inner)
+                {
+                    outer = 1;
+                    n = 1;
+                    inner = 1;
+                    for (size_t i = 0; i < input_shape.size(); i++)
+                    {
+                        if (i < *softmax_axes.begin())
+                        {
+                            outer *= input_shape[i];
+                        }
+                        else if (i <= *softmax_axes.rbegin())
+                        {
+                            n *= input_shape[i];
+                        }
+                        else
+                        {
+                            inner *= input_shape[i];
+                        }
+                    }
+                }
+
+                // Softmax (or log-softmax) over the middle dimension of [outer, n, inner].
+                // Each task owns up to softmax_lanes independent reductions that share a
+                // contiguous row. One pass keeps a running max m and a running sum s of
+                // exp(x - m) per lane, rescaling s whenever m grows, and a second pass writes
+                // the outputs. When inner == 1 a row is itself split across the lanes, and the
+                // per-lane statistics are combined at the end.
+                template <typename ElementType, bool Log>
+                void softmax_online(const ElementType* in,
+                                    ElementType* out,
+                                    size_t outer,
+                                    size_t n,
+                                    size_t inner,
+                                    int arena)
+                {
+                    using Acc = typename softmax_accumulator<ElementType>::type;
+                    using Lanes = Eigen::Array<Acc, Eigen::Dynamic, 1, 0, softmax_lanes, 1>;
+
+                    if (outer == 0 || n == 0 || inner == 0)
+                    {
+                        return;
+                    }
+
+                    auto load = [](const ElementType* src, size_t width, Lanes& dst) {
+                        for (size_t c = 0; c < width; c++)
+                        {
+                            dst[c] = static_cast<Acc>(src[c]);
+                        }
+                    };
+                    auto store = [](const Lanes& src, size_t width, ElementType* dst) {
+                        for (size_t c = 0; c < width; c++)
+                        {
+                            dst[c] = static_cast<ElementType>(src[c]);
+                        }
+                    };
+                    // Folds x into the running statistics (m, s) of each lane. Terms equal to
+                    // the new max contribute exactly 1, which also keeps -inf inputs (masked
+                    // positions) from producing -inf - -inf = NaN.
+                    auto accumulate = [](const Lanes& x, Lanes& m, Lanes& s) {
+                        Lanes m_new = m.max(x);
+                        s = (m == m_new).select(s, s * (m - m_new).exp()) +
+                            (x == m_new).select(Lanes::Ones(x.size()), (x - m_new).exp());
+                        m = m_new;
+                    };
+
+                    std::function<void(Eigen::Index, Eigen::Index)> block;
+                    Eigen::Index tasks;
+                    size_t chunks = (inner + softmax_lanes - 1) / softmax_lanes;
+                    if (inner == 1)
+                    {
+                        tasks = static_cast<Eigen::Index>(outer);
+                        block = [&](Eigen::Index begin, Eigen::Index end) {
+                            Lanes x(softmax_lanes), y(softmax_lanes);
+                            Lanes m(softmax_lanes), s(softmax_lanes);
+                            for (Eigen::Index r = begin; r < end; r++)
+                            {
+                                const ElementType* src = in + r * n;
+                                ElementType* dst = out + r * n;
+                                size_t steps = n / softmax_lanes;
+                                Acc row_m;
+                                Acc row_s;
+                                if (steps > 0)
+                                {
+                                    load(src, softmax_lanes, m);
+                                    s.setOnes();
+                                    for (size_t j = 1; j < steps; j++)
+                                    {
+                                        load(src + j * softmax_lanes, softmax_lanes, x);
+                                        accumulate(x, m, s);
+                                    }
+                                    row_m = m.maxCoeff();
+                                    row_s = (m == row_m).select(s, s * (m - row_m).exp()).sum();
+                                }
+                                else
+                                {
+                                    row_m = static_cast<Acc>(src[0]);
+                                    row_s = 0;
+                                }
+                                for (size_t i = steps * softmax_lanes; i < n; i++)
+                                {
+                                    Acc v = static_cast<Acc>(src[i]);
+                                    if (v > row_m)
+                                    {
+                                        row_s = row_s * std::exp(row_m - v) + 1;
+                                        row_m = v;
+                                    }
+                                    else
+                                    {
+                                        // Exact equality keeps a -inf maximum from giving NaN
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+                                        row_s += v == row_m ? 1 : std::exp(v - row_m);
+#pragma GCC diagnostic pop
+                                    }
+                                }
+
+                                Acc log_s = std::log(row_s);
+                                for (size_t i = 0; i < n; i += softmax_lanes)
+                                {
+                                    size_t width = std::min(softmax_lanes, n - i);
+                                    x.resize(width);
+                                    load(src + i, width, x);
+                                    if (Log)
+                                    {
+                                        y = x - row_m - log_s;
+                                    }
+                                    else
+                                    {
+                                        y = (x - row_m).exp() / row_s;
+                                    }
+                                    store(y, width, dst + i);
+                                }
+                                x.resize(softmax_lanes);
+                            }
+                        };
+                    }
+                    else
+                    {
+                        tasks = static_cast<Eigen::Index>(outer * chunks);
+                        block = [&](Eigen::Index begin, Eigen::Index end) {
+                            Lanes x, y, m, s, log_s;
+                            for (Eigen::Index t = begin; t < end; t++)
+                            {
+                                size_t o = static_cast<size_t>(t) / chunks;
+                                size_t c0 = (static_cast<size_t>(t) % chunks) * softmax_lanes;
+                                size_t width = std::min(softmax_lanes, inner - c0);
+                                const ElementType* src = in + o * n * inner + c0;
+                                ElementType* dst = out + o * n * inner + c0;
+                                x.resize(width);
+                                m.resize(width);
+                                s.resize(width);
+
+                                load(src, width, m);
+                                s.setOnes();
+                                for (size_t j = 1; j < n; j++)
+                                {
+                                    load(src + j * inner, width, x);
+                                    accumulate(x, m, s);
+                                }
+
+                                log_s = s.log();
+                                for (size_t j = 0; j < n; j++)
+                                {
+                                    load(src + j * inner, width, x);
+                                    if (Log)
+                                    {
+                                        y = x - m - log_s;
+                                    }
+                                    else
+                                    {
+                                        y = (x - m).exp() / s;
+                                    }
+                                    store(y, width, dst + j * inner);
+                                }
+                            }
+                        };
+                    }
+
+                    // Two reads and one write per element, plus two exponentials
+                    double task_elements = static_cast<double>(n * std::min(inner, softmax_lanes));
+                    Eigen::TensorOpCost cost(
+                        2 * task_elements * sizeof(ElementType),
+                        task_elements * sizeof(ElementType),
+                        2 * task_elements *
+                            Eigen::internal::functor_traits<
+                                Eigen::internal::scalar_exp_op<Acc>>::Cost);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        tasks, cost, block);
+                }
+
+                // Softmax over a contiguous range of axes, for any rank
+                template <typename ElementType>
+                void softmax_contiguous(void* input,
+                                        void* output,
+                                        const Shape& input_shape,
+                                        const AxisSet& softmax_axes,
+                                        int arena)
+                {
+                    size_t outer, n, inner;
+                    softmax_view(input_shape, softmax_axes, outer, n, inner);
+                    softmax_online<ElementType, false>(static_cast<ElementType*>(input),
+                                                       static_cast<ElementType*>(output),
+                                                       outer,
+                                                       n,
+                                                       inner,
+                                                       arena);
+                }
+
+                // Log(Softmax) over a contiguous range of axes, for any rank
+                template <typename ElementType>
+                void log_softmax_contiguous(void* input,
+                                            void* output,
+                                            const Shape& input_shape,
+                                            const AxisSet& softmax_axes,
+                                            int arena)
+                {
+                    size_t outer, n, inner;
+                    softmax_view(input_shape, softmax_axes, outer, n, inner);
+                    softmax_online<ElementType, true>(static_cast<ElementType*>(input),
+                                                      static_cast<ElementType*>(output),
+                                                      outer,
+                                                      n,
+                                                      inner,
+                                                      arena);
+                }
             }
         }
     }
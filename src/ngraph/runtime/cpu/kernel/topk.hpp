@@ -0,0 +1,269 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Orders (value, index) entries the same way as reference::topk: best value
+                // first, ties broken by the lower index.
+                template <typename T, typename U>
+                struct topk_greater
+                {
+                    bool operator()(const T& a, const T& b) const { return a > b; }
+                    bool operator()(const std::pair<T, U>& a, const std::pair<T, U>& b) const
+                    {
+                        if (a.first > b.first)
+                        {
+                            return true;
+                        }
+                        if (b.first > a.first)
+                        {
+                            return false;
+                        }
+                        return a.second < b.second;
+                    }
+                };
+
+                template <typename T, typename U>
+                struct topk_less
+                {
+                    bool operator()(const T& a, const T& b) const { return a < b; }
+                    bool operator()(const std::pair<T, U>& a, const std::pair<T, U>& b) const
+                    {
+                        if (a.first < b.first)
+                        {
+                            return true;
+                        }
+                        if (b.first < a.first)
+                        {
+                            return false;
+                        }
+                        return a.second < b.second;
+                    }
+                };
+
+                // Selects the k best elements of one slice of length n, read with the given
+                // stride, and writes them in order to out_indices/out_values with the same
+                // stride. workspace is scratch space owned by the calling thread.
+                template <typename T, typename U, typename Compare>
+                void topk_slice(const T* in,
+                                U* out_indices,
+                                T* out_values,
+                                size_t stride,
+                                size_t n,
+                                size_t k,
+                                Compare before,
+                                std::vector<std::pair<T, U>>& workspace)
+                {
+                    if (k == 0)
+                    {
+                        return;
+                    }
+
+                    if (k == 1 && stride == 1)
+                    {
+                        // Innermost axis: a branch-free reduction the compiler can vectorize,
+                        // then a second scan for the first index holding the winning value.
+                        T best = in[0];
+                        for (size_t i = 1; i < n; i++)
+                        {
+                            best = before(in[i], best) ? in[i] : best;
+                        }
+                        U index = 0;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            if (in[i] == best)
+                            {
+                                index = static_cast<U>(i);
+                                break;
+                            }
+                        }
+#pragma GCC diagnostic pop
+                        out_values[0] = best;
+                        out_indices[0] = index;
+                        return;
+                    }
+
+                    if (k == 1)
+                    {
+                        // Single pass; a later element only wins if it is strictly better
+                        std::pair<T, U> best(in[0], 0);
+                        for (size_t i = 1; i < n; i++)
+                        {
+                            std::pair<T, U> candidate(in[i * stride], static_cast<U>(i));
+                            if (before(candidate, best))
+                            {
+                                best = candidate;
+                            }
+                        }
+                        out_values[0] = best.first;
+                        out_indices[0] = best.second;
+                        return;
+                    }
+
+                    workspace.clear();
+                    if (k * 8 <= n)
+                    {
+                        // Small k: stream the slice through a bounded heap whose top is the
+                        // worst of the current k candidates, so most elements are rejected
+                        // with a single comparison.
+                        for (size_t i = 0; i < k; i++)
+                        {
+                            workspace.emplace_back(in[i * stride], static_cast<U>(i));
+                        }
+                        std::make_heap(workspace.begin(), workspace.end(), before);
+                        for (size_t i = k; i < n; i++)
+                        {
+                            std::pair<T, U> candidate(in[i * stride], static_cast<U>(i));
+                            if (before(candidate, workspace.front()))
+                            {
+                                std::pop_heap(workspace.begin(), workspace.end(), before);
+                                workspace.back() = candidate;
+                                std::push_heap(workspace.begin(), workspace.end(), before);
+                            }
+                        }
+                        std::sort_heap(workspace.begin(), workspace.end(), before);
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < n; i++)
+                        {
+                            workspace.emplace_back(in[i * stride], static_cast<U>(i));
+                        }
+                        if (k < n)
+                        {
+                            std::nth_element(workspace.begin(),
+                                             workspace.begin() + (k - 1),
+                                             workspace.end(),
+                                             before);
+                        }
+                        std::sort(workspace.begin(), workspace.begin() + k, before);
+                    }
+
+                    for (size_t i = 0; i < k; i++)
+                    {
+                        out_values[i * stride] = workspace[i].first;
+                        out_indices[i * stride] = workspace[i].second;
+                    }
+                }
+
+                // TopK along an arbitrary axis. The input is viewed as
+                // [outer, in_shape[axis], inner] and the outer * inner independent slices are
+                // partitioned across the threads of the arena.
+                template <typename T, typename U>
+                void topk(void* input,
+                          void* out_indices,
+                          void* out_values,
+                          const Shape& in_shape,
+                          const Shape& out_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max,
+                          int arena)
+                {
+                    size_t outer = 1;
+                    size_t inner = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= in_shape[i];
+                    }
+                    for (size_t i = axis + 1; i < in_shape.size(); i++)
+                    {
+                        inner *= in_shape[i];
+                    }
+                    size_t n = in_shape[axis];
+                    size_t out_k = out_shape[axis];
+                    k = std::min(k, out_k);
+
+                    size_t slices = outer * inner;
+                    if (slices == 0 || n == 0)
+                    {
+                        return;
+                    }
+
+                    const T* in = static_cast<const T*>(input);
+                    U* indices = static_cast<U*>(out_indices);
+                    T* values = static_cast<T*>(out_values);
+
+                    auto block = [&](Eigen::Index begin, Eigen::Index end) {
+                        std::vector<std::pair<T, U>> workspace;
+                        workspace.reserve(k * 8 <= n ? k : n);
+                        for (Eigen::Index s = begin; s < end; s++)
+                        {
+                            size_t o = static_cast<size_t>(s) / inner;
+                            size_t i = static_cast<size_t>(s) % inner;
+                            const T* src = in + o * n * inner + i;
+                            U* dst_indices = indices + o * out_k * inner + i;
+                            T* dst_values = values + o * out_k * inner + i;
+                            if (compute_max)
+                            {
+                                topk_slice(src,
+                                           dst_indices,
+                                           dst_values,
+                                           inner,
+                                           n,
+                                           k,
+                                           topk_greater<T, U>(),
+                                           workspace);
+                            }
+                            else
+                            {
+                                topk_slice(src,
+                                           dst_indices,
+                                           dst_values,
+                                           inner,
+                                           n,
+                                           k,
+                                           topk_less<T, U>(),
+                                           workspace);
+                            }
+                        }
+                    };
+
+                    // Rough per-slice cost: every element is loaded and compared against the
+                    // heap top, and the survivors pay a log(k) heap update.
+                    double compute = static_cast<double>(n) *
+                                     (1.0 + std::log2(static_cast<double>(k) + 1.0));
+                    Eigen::TensorOpCost cost(static_cast<double>(n * sizeof(T)),
+                                             static_cast<double>(k * (sizeof(T) + sizeof(U))),
+                                             compute);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        static_cast<Eigen::Index>(slices), cost, block);
+                }
+            }
+        }
+    }
+}
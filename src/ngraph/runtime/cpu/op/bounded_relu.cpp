@@ -35,3 +35,13 @@ shared_ptr<Node> op::BoundedRelu::copy_with_new_args(const NodeVector& new_args)
     }
     return make_shared<BoundedRelu>(new_args.at(0), m_alpha);
 }
+
+size_t op::BoundedRelu::get_attributes_hash() const
+{
+    return hash<float>()(m_alpha);
+}
+
+bool op::BoundedRelu::has_same_attributes(const Node& other) const
+{
+    return m_alpha == static_cast<const BoundedRelu&>(other).m_alpha;
+}
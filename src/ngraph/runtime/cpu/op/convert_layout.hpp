@@ -49,6 +49,7 @@ namespace ngraph
                     virtual std::shared_ptr<Node>
                         copy_with_new_args(const NodeVector& new_args) const override;
 
+                    size_t get_arg_output_index() const { return arg_output_index; }
                 protected:
                     size_t arg_output_index;
                     std::shared_ptr<ngraph::runtime::cpu::LayoutDescriptor> output_layout;
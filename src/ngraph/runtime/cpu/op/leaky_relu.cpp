@@ -39,3 +39,13 @@ shared_ptr<Node> op::CPULeakyRelu::copy_with_new_args(const NodeVector& new_args
     }
     return make_shared<CPULeakyRelu>(new_args.at(0), m_alpha);
 }
+
+size_t op::CPULeakyRelu::get_attributes_hash() const
+{
+    return hash<float>()(m_alpha);
+}
+
+bool op::CPULeakyRelu::has_same_attributes(const Node& other) const
+{
+    return m_alpha == static_cast<const CPULeakyRelu&>(other).m_alpha;
+}
@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/log_softmax.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::CPULogSoftmax::CPULogSoftmax(const shared_ptr<Node>& arg, const AxisSet& axes)
+    : UnaryElementwiseArithmetic("CPULogSoftmax", arg)
+    , m_axes(axes)
+{
+    constructor_validate_and_infer_types();
+
+    for (auto axis : m_axes)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              axis < get_shape().size(),
+                              "Reduction axis (",
+                              axis,
+                              ") is out of bounds (argument shape: ",
+                              get_shape(),
+                              ").");
+    }
+}
+
+shared_ptr<Node> op::CPULogSoftmax::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<CPULogSoftmax>(new_args.at(0), m_axes);
+}
+
+size_t op::CPULogSoftmax::get_attributes_hash() const
+{
+    return hash_combine(vector<size_t>(m_axes.begin(), m_axes.end()));
+}
+
+bool op::CPULogSoftmax::has_same_attributes(const Node& other) const
+{
+    return m_axes == static_cast<const CPULogSoftmax&>(other).m_axes;
+}
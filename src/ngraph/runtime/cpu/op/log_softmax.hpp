@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Log(Softmax(arg)) over the given axes, computed as
+        ///        arg - max - log(sum(exp(arg - max))) without materializing the softmax.
+        ///
+        class CPULogSoftmax : public util::UnaryElementwiseArithmetic
+        {
+        public:
+            /// \brief Constructs a CPULogSoftmax operation.
+            ///
+            /// \param arg Node that produces the input tensor.
+            /// \param axes The axis positions (0-based) to normalize over.
+            CPU_BACKEND_API CPULogSoftmax(const std::shared_ptr<Node>& arg, const AxisSet& axes);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+            size_t get_attributes_hash() const override;
+            bool has_same_attributes(const Node& other) const override;
+
+            const AxisSet& get_axes() const { return m_axes; }
+        private:
+            AxisSet m_axes;
+        };
+    }
+}
@@ -46,6 +46,7 @@
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
@@ -59,6 +60,7 @@
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -66,6 +68,7 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
+#include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -74,6 +77,7 @@
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+#include "ngraph/runtime/cpu/op/log_softmax.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
@@ -1777,6 +1781,50 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_update_slice()
     this->add_matcher(m, callback);
 }
 
+// Log(Softmax(x)) -> CPULogSoftmax(x)
+void ngraph::runtime::cpu::pass::CPUFusion::construct_log_softmax()
+{
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto softmax = std::make_shared<ngraph::op::Softmax>(input, AxisSet{1});
+    auto log = std::make_shared<ngraph::op::Log>(softmax);
+
+    auto callback = [input](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for log_softmax = " << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto softmax_m =
+            std::static_pointer_cast<ngraph::op::Softmax>(m.get_match_root()->get_argument(0));
+
+        auto et = softmax_m->get_element_type();
+        if (et != element::f32 && et != element::f64 && et != element::f16 &&
+            et != element::bf16)
+        {
+            NGRAPH_DEBUG << "LogSoftmax cannot be created, unsupported element type";
+            return false;
+        }
+
+        // The native kernel reduces over a single contiguous range of axes
+        const AxisSet& axes = softmax_m->get_axes();
+        if (!ngraph::runtime::cpu::kernel::softmax_axes_contiguous(axes))
+        {
+            NGRAPH_DEBUG << "LogSoftmax cannot be created, softmax axes are not contiguous";
+            return false;
+        }
+
+        if (softmax_m->get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "LogSoftmax cannot be created, softmax output required";
+            return false;
+        }
+
+        auto log_softmax = std::make_shared<ngraph::op::CPULogSoftmax>(pattern_map[input], axes);
+        ngraph::replace_node(m.get_match_root(), log_softmax);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(log, "CPUFusion.CPULogSoftmax");
+    this->add_matcher(m, callback);
+}
+
 // QuantizedConvolution + Dequantize + Relu -> QuantizedConvolutionRelu + Dequantize
 void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qconv_relu(bool with_bias)
 {
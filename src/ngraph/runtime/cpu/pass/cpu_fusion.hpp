@@ -70,6 +70,7 @@ public:
             construct_conv_add();
             construct_conv_add_relu();
             construct_update_slice();
+            construct_log_softmax();
             construct_fuse_lstm_recurrent_state();
             if (std::getenv("NGRAPH_DECONV_FUSE") != nullptr)
             {
@@ -102,6 +103,7 @@ private:
     void construct_groupconv_batchnorm_global_stats_folding();
     void construct_groupconv_batchnorm_global_stats_folding_relu();
     void construct_update_slice();
+    void construct_log_softmax();
     void construct_fuse_lstm_recurrent_state();
     void construct_deconvolution_affine_folding();
     void construct_deconvolution_affine_folding_relu();
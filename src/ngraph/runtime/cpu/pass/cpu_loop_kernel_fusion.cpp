@@ -23,12 +23,20 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
@@ -63,22 +71,26 @@ public:
                 if (!arg_from_fusible_group)
                 {
                     m_heads.insert(std::make_pair(n, n));
-                    m_graphs.insert(std::make_pair(n, LKGraph{{n}, n->get_arguments()}));
+                    m_graphs.insert(std::make_pair(n, LKGraph{{}, {}}));
+                    for (auto arg : n->get_arguments())
+                    {
+                        add_external_arg(n, arg);
+                    }
+                    m_graphs.at(n).m_nodes.push_back(n);
                     NGRAPH_DEBUG << "Created a new group for " << n->get_name();
                     log_group(n);
                 }
                 else
                 {
                     auto smallest_head = m_heads.at(arg_from_fusible_group);
-                    auto& lkgraph = m_graphs.at(smallest_head);
-                    lkgraph.m_nodes.push_back(n);
                     for (auto arg : n->get_arguments())
                     {
-                        if (is_leaf(arg))
+                        if (m_heads.count(arg) == 0)
                         {
-                            lkgraph.m_inputs.push_back(arg);
+                            add_external_arg(smallest_head, arg);
                         }
                     }
+                    m_graphs.at(smallest_head).m_nodes.push_back(n);
                     m_heads.insert(std::make_pair(n, smallest_head));
                     log_group(smallest_head);
                 }
@@ -111,16 +123,54 @@ private:
                                                                TI(ngraph::op::Subtract),
                                                                TI(ngraph::op::Relu),
                                                                TI(ngraph::op::Minimum),
-                                                               TI(ngraph::op::Maximum)};
+                                                               TI(ngraph::op::Maximum),
+                                                               TI(ngraph::op::Multiply),
+                                                               TI(ngraph::op::Divide),
+                                                               TI(ngraph::op::Exp),
+                                                               TI(ngraph::op::Log),
+                                                               TI(ngraph::op::Sqrt),
+                                                               TI(ngraph::op::Tanh),
+                                                               TI(ngraph::op::Sigmoid)};
 
         const Node& node = *n;
-        return fusible_ops_set.count(TI(node)) != 0;
+        return fusible_ops_set.count(TI(node)) != 0 && is_supported_type(n);
 
         // return (std::dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(n) ||
         //         std::dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(n));
     }
 
+    // LoopKernels are evaluated in floating point
+    static bool is_supported_type(std::shared_ptr<Node> n)
+    {
+        return n->get_output_size() == 1 &&
+               (n->get_element_type() == element::f32 || n->get_element_type() == element::f64);
+    }
+
     bool is_leaf(std::shared_ptr<Node> src) { return src->is_parameter() || src->is_constant(); }
+    // A broadcast feeding only one fusible node is pulled into that node's group, so the
+    // broadcast tensor is never materialized
+    bool is_absorbable_broadcast(std::shared_ptr<Node> n)
+    {
+        const Node& node = *n;
+        return TI(node) == TI(ngraph::op::Broadcast) && is_supported_type(n) &&
+               n->get_users().size() == 1 && m_heads.count(n->get_argument(0)) == 0;
+    }
+
+    void add_external_arg(std::shared_ptr<Node> head, std::shared_ptr<Node> arg)
+    {
+        auto& lkgraph = m_graphs.at(head);
+        if (is_absorbable_broadcast(arg))
+        {
+            lkgraph.m_nodes.push_back(arg);
+            lkgraph.m_inputs.push_back(arg->get_argument(0));
+            m_heads.insert(std::make_pair(arg, head));
+        }
+        else
+        {
+            lkgraph.m_inputs.push_back(arg);
+        }
+    }
+
     void prune_graphs(size_t min_nodes_to_fuse)
     {
         for (auto it = m_graphs.begin(); it != m_graphs.end();)
@@ -143,6 +193,34 @@ private:
         NGRAPH_DEBUG << "Inputs: " << m_graphs.at(head).m_inputs << std::endl;
     }
 
+    bool has_leaf_inputs_only(std::shared_ptr<Node> head)
+    {
+        const auto& inputs = m_graphs.at(head).m_inputs;
+        return std::all_of(inputs.begin(), inputs.end(), [this](std::shared_ptr<Node> input) {
+            return is_leaf(input);
+        });
+    }
+
+    // Moves the members of other's group into head's group
+    void merge_groups(std::shared_ptr<Node> head, std::shared_ptr<Node> other)
+    {
+        auto& lkgraph = m_graphs.at(head);
+        auto& other_lkgraph = m_graphs.at(other);
+        lkgraph.m_nodes.insert(
+            lkgraph.m_nodes.end(), other_lkgraph.m_nodes.begin(), other_lkgraph.m_nodes.end());
+        lkgraph.m_inputs.insert(
+            lkgraph.m_inputs.end(), other_lkgraph.m_inputs.begin(), other_lkgraph.m_inputs.end());
+        for (auto& entry : m_heads)
+        {
+            if (entry.second == other)
+            {
+                entry.second = head;
+            }
+        }
+        m_graphs.erase(other);
+        NGRAPH_DEBUG << "Merged group " << other->get_name() << " into " << head->get_name();
+    }
+
     std::shared_ptr<Node> collect_fusible_args(std::shared_ptr<Node> n)
     {
         std::shared_ptr<Node> arg_from_fusible_group;
@@ -156,14 +234,26 @@ private:
                 {
                     arg_from_fusible_group = arg;
                 }
-                else
+                else if (m_heads.at(arg) != m_heads.at(arg_from_fusible_group))
                 {
-                    if (!is_leaf(arg) && m_heads.at(arg) != m_heads.at(arg_from_fusible_group))
+                    // groups that only read leaves can't depend on each other, so they
+                    // can be merged without creating a cycle
+                    auto head = m_heads.at(arg_from_fusible_group);
+                    auto other = m_heads.at(arg);
+                    if (!has_leaf_inputs_only(head) || !has_leaf_inputs_only(other))
                     {
                         return {nullptr};
                     }
+                    merge_groups(head, other);
                 }
             }
+            else if (!is_leaf(arg) &&
+                     !(is_absorbable_broadcast(arg) && is_leaf(arg->get_argument(0))))
+            {
+                // joining a group through any other producer could make the group
+                // depend on its own outputs
+                return {nullptr};
+            }
         }
         return arg_from_fusible_group;
     }
@@ -36,9 +36,12 @@ runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
         bufferID_to_tensorSets,
     unordered_map<descriptor::Tensor*, size_t>& tensor_to_bufferID,
     size_t alignment,
-    bool disable_memory_sharing)
+    bool disable_memory_sharing,
+    bool interval_planning)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_interval_planning(interval_planning ||
+                          std::getenv("NGRAPH_INTERVAL_MEMORY_PLANNER") != nullptr)
     , m_bufferID_to_tensorSets(bufferID_to_tensorSets)
     , m_tensor_to_bufferID(tensor_to_bufferID)
 {
@@ -56,7 +59,7 @@ size_t runtime::cpu::pass::CPUMemoryAssignment::get_bufferID(descriptor::Tensor*
 }
 
 void runtime::cpu::pass::CPUMemoryAssignment::process_in_place_concat(
-    std::list<std::shared_ptr<Node>> nodes)
+    std::vector<std::shared_ptr<Node>> nodes)
 {
     for (shared_ptr<Node> node : nodes)
     {
@@ -234,7 +237,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::propagate_in_place_concat(
 
 //slice
 void runtime::cpu::pass::CPUMemoryAssignment::process_in_place_slice(
-    std::list<std::shared_ptr<Node>> nodes)
+    std::vector<std::shared_ptr<Node>> nodes)
 {
     for (shared_ptr<Node>& node : nodes)
     {
@@ -357,7 +360,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::propagate_in_place_slice(
 // TensorRole is INPUT, CONSTANT, OUTPUT, or INTERMEDIATE,
 // which tells from where the memory buffer comes.
 // tensor_to_bufferID maps tensor to the ID of the buffer set it belongs to.
-void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared_ptr<Node>>& ops)
+void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(vector<shared_ptr<Node>>& ops)
 {
     unordered_set<descriptor::Tensor*> in_place_slice_chain;
     size_t count = 0;
@@ -569,7 +572,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared
 }
 
 void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
-    std::list<std::shared_ptr<Node>>& ops)
+    std::vector<std::shared_ptr<Node>>& ops)
 {
     auto find_role = [](TensorRole tensor_role) -> string {
         switch (tensor_role)
@@ -643,7 +646,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
 
 bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph::Function> function)
 {
-    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    vector<shared_ptr<Node>> ops = function->get_ordered_ops();
 
     build_buffer_sets_maps(ops);
     liveness_analysis(ops);
@@ -654,6 +657,13 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
+    // offline alternative to mm, places the non-cacheable buffers once all live ranges are known
+    bool interval_planning = m_interval_planning && !m_disable_memory_sharing;
+    ngraph::pass::IntervalMemoryPlanner planner(m_alignment);
+    // planner buffer of each buffer set, the output set of a destructive oi pair shares the
+    // buffer of its input set
+    unordered_map<size_t, size_t> planned_buffers;
+    size_t step = 0;
 
     // reuse memory
     if (!m_disable_memory_sharing)
@@ -683,6 +693,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
 
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
+        step++;
         if (node->is_parameter() || node->is_constant() || node->is_output())
         {
             continue;
@@ -782,6 +793,12 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                         // do not combine those two sets.
                         // change the label of output tensor set to that of input tensor set
                         output_buffer_it->second.first = input_buffer_it->second.first;
+                        auto planned_input = planned_buffers.find(input_bufferID);
+                        if (planned_input != planned_buffers.end())
+                        {
+                            planned_buffers[output_bufferID] = planned_input->second;
+                            continue;
+                        }
                         for (auto& ele_t : output_set)
                         {
                             ele_t->set_pool_offset(offset);
@@ -814,6 +831,11 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
             {
                 offset = mm_caching.allocate(size);
             }
+            else if (interval_planning)
+            {
+                planned_buffers[bufferID] = planner.add_buffer(size, step);
+                continue;
+            }
             else
             {
                 offset = mm.allocate(size);
@@ -837,12 +859,38 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                 if (m_tensor_caching.empty() ||
                     (!m_tensor_caching.empty() && m_tensor_caching.count(tensor) == 0))
                 {
-                    mm.free(tensor->get_pool_offset());
+                    if (!interval_planning)
+                    {
+                        mm.free(tensor->get_pool_offset());
+                        continue;
+                    }
+                    auto planned = planned_buffers.find(get_bufferID(tensor));
+                    if (planned != planned_buffers.end())
+                    {
+                        planner.release(planned->second, step);
+                    }
                 }
             }
         }
     }
 
+    size_t pool_size = mm.max_allocated();
+    if (interval_planning)
+    {
+        planner.plan();
+        for (auto& planned : planned_buffers)
+        {
+            size_t offset = planner.get_offset(planned.second);
+            for (auto& tensor : m_bufferID_to_tensorSets.at(planned.first).second)
+            {
+                tensor->set_pool_offset(offset);
+            }
+        }
+        pool_size = planner.max_allocated();
+        NGRAPH_DEBUG << "cpu_memory_assignment: planned " << pool_size
+                     << " bytes, lower bound is " << planner.lower_bound();
+    }
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -851,7 +899,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     process_in_place_slice(ops);
 
     //update the offset for intermediate tensors in tensor_caching
-    auto start = mm.max_allocated();
+    auto start = pool_size;
     for (auto item : m_tensor_caching)
     {
         auto bufferID = get_bufferID(item);
@@ -865,13 +913,13 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
-    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << mm.max_allocated();
+    NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << pool_size;
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated for mm_caching is "
                  << mm_caching.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is "
-                 << mm.max_allocated() + mm_caching.max_allocated();
+                 << pool_size + mm_caching.max_allocated();
 
-    function->set_temporary_pool_size(mm.max_allocated() + mm_caching.max_allocated());
+    function->set_temporary_pool_size(pool_size + mm_caching.max_allocated());
 
     return false;
 }
@@ -17,10 +17,10 @@
 #pragma once
 
 #include <limits>
-#include <list>
 #include <sstream>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/util.hpp"
@@ -45,32 +45,35 @@ public:
         std::unordered_map<size_t, std::pair<TensorRole, std::unordered_set<descriptor::Tensor*>>>&,
         std::unordered_map<descriptor::Tensor*, size_t>&,
         size_t alignment = 1,
-        bool disable_memory_sharing = false);
+        bool disable_memory_sharing = false,
+        bool interval_planning = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
     // Find in-place concat ops and set appropriate memory pool offset for its arguments
-    void process_in_place_concat(std::list<std::shared_ptr<Node>> nodes);
+    void process_in_place_concat(std::vector<std::shared_ptr<Node>> nodes);
 
     // For a chain of concat ops, propagate memory pool offsets
     void propagate_in_place_concat(std::shared_ptr<ngraph::op::Op> concat, size_t index);
 
     // Find in-place slice ops and set appropriate memory pool offset for its output
-    void process_in_place_slice(std::list<std::shared_ptr<Node>> nodes);
+    void process_in_place_slice(std::vector<std::shared_ptr<Node>> nodes);
 
     // propagate slice when its arg comes from function input
     void propagate_in_place_slice(ngraph::descriptor::Input* input, size_t input_index);
 
     // build buffer sets maps
-    void build_buffer_sets_maps(std::list<std::shared_ptr<Node>>& ops);
+    void build_buffer_sets_maps(std::vector<std::shared_ptr<Node>>& ops);
 
     // liveness analysis to build new and free list for each node
-    void liveness_analysis(std::list<std::shared_ptr<Node>>& ops);
+    void liveness_analysis(std::vector<std::shared_ptr<Node>>& ops);
 
     size_t get_bufferID(descriptor::Tensor* tensor);
 
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    // place buffers with IntervalMemoryPlanner, also enabled by NGRAPH_INTERVAL_MEMORY_PLANNER
+    bool m_interval_planning;
     std::set<descriptor::Tensor*> m_tensor_caching;
     std::unordered_map<size_t,
                        std::pair<ngraph::TensorRole, std::unordered_set<descriptor::Tensor*>>>&
@@ -0,0 +1,394 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/runtime/dynamic/batching_executable.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Number of elements in the dimensions before and from `axis` on
+static size_t outer_size(const Shape& shape, size_t axis)
+{
+    return shape_size(Shape(shape.begin(), shape.begin() + axis));
+}
+
+static size_t inner_size(const Shape& shape, size_t axis)
+{
+    return shape_size(Shape(shape.begin() + axis, shape.end()));
+}
+
+// Copies `count` blocks of `block` bytes between buffers whose blocks are `dst_stride` and
+// `src_stride` bytes apart
+static void copy_blocks(
+    char* dst, size_t dst_stride, const char* src, size_t src_stride, size_t block, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        memcpy(dst + i * dst_stride, src + i * src_stride, block);
+    }
+}
+
+runtime::dynamic::BatchingExecutable::BatchingExecutable(
+    shared_ptr<runtime::Backend> backend,
+    shared_ptr<runtime::Executable> executable,
+    size_t batch_axis,
+    size_t max_batch_size,
+    chrono::microseconds max_latency)
+    : m_backend(backend)
+    , m_executable(executable)
+    , m_batch_axis(batch_axis)
+    , m_max_batch_size(max_batch_size)
+    , m_max_latency(max_latency)
+{
+    NGRAPH_CHECK(m_max_batch_size > 0, "BatchingExecutable needs a positive max_batch_size");
+    for (auto& parameter : m_executable->get_parameters())
+    {
+        const PartialShape& shape = parameter->get_output_partial_shape(0);
+        NGRAPH_CHECK(shape.rank().is_dynamic() ||
+                         static_cast<size_t>(shape.rank()) > m_batch_axis,
+                     "Parameter ",
+                     parameter->get_name(),
+                     " has no batch axis ",
+                     m_batch_axis);
+    }
+    Function function(m_executable->get_results(), m_executable->get_parameters());
+    set_parameters_and_results(function);
+
+    m_dispatcher = thread(&BatchingExecutable::dispatch_loop, this);
+}
+
+runtime::dynamic::BatchingExecutable::~BatchingExecutable()
+{
+    {
+        lock_guard<mutex> lock(m_queue_mutex);
+        m_shutdown = true;
+    }
+    m_queue_cv.notify_one();
+    m_dispatcher.join();
+}
+
+bool runtime::dynamic::BatchingExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return call_async(outputs, inputs).get();
+}
+
+void runtime::dynamic::BatchingExecutable::call_async(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs,
+    CallCallback callback)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size(),
+                 "Call input count ",
+                 inputs.size(),
+                 " does not match Function's Parameter count ",
+                 get_parameters().size());
+    NGRAPH_CHECK(outputs.size() == get_results().size(),
+                 "Call output count ",
+                 outputs.size(),
+                 " does not match Function's Result count ",
+                 get_results().size());
+
+    Request request;
+    request.outputs = outputs;
+    request.inputs = inputs;
+    request.callback = callback;
+    request.batch_size = 1;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        const Shape& shape = inputs[i]->get_shape();
+        NGRAPH_CHECK(shape.size() > m_batch_axis, "Input ", i, " has no batch axis");
+        NGRAPH_CHECK(i == 0 || shape[m_batch_axis] == request.batch_size,
+                     "Inputs disagree on the batch size");
+        request.batch_size = shape[m_batch_axis];
+    }
+
+    {
+        lock_guard<mutex> lock(m_queue_mutex);
+        request.enqueue_time = Clock::now();
+        m_queue.push_back(move(request));
+    }
+    m_queue_cv.notify_one();
+}
+
+bool runtime::dynamic::BatchingExecutable::can_batch_with(const Request& first,
+                                                          const Request& request) const
+{
+    for (size_t i = 0; i < first.inputs.size(); i++)
+    {
+        if (first.inputs[i]->get_element_type() != request.inputs[i]->get_element_type())
+        {
+            return false;
+        }
+        Shape first_shape = first.inputs[i]->get_shape();
+        Shape shape = request.inputs[i]->get_shape();
+        first_shape[m_batch_axis] = 0;
+        shape[m_batch_axis] = 0;
+        if (first_shape != shape)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void runtime::dynamic::BatchingExecutable::dispatch_loop()
+{
+    unique_lock<mutex> lock(m_queue_mutex);
+    while (true)
+    {
+        m_queue_cv.wait(lock, [this] { return m_shutdown || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            return;
+        }
+
+        // Samples that would join the batch of the oldest call
+        auto batchable_samples = [this]() {
+            size_t samples = 0;
+            for (const Request& request : m_queue)
+            {
+                if (!can_batch_with(m_queue.front(), request))
+                {
+                    break;
+                }
+                samples += request.batch_size;
+            }
+            return samples;
+        };
+        Clock::time_point deadline = m_queue.front().enqueue_time + m_max_latency;
+        while (!m_shutdown && batchable_samples() < m_max_batch_size && Clock::now() < deadline)
+        {
+            m_queue_cv.wait_until(lock, deadline);
+        }
+
+        // The oldest call is always taken, even if it alone exceeds max_batch_size
+        vector<Request> batch;
+        size_t samples = 0;
+        do
+        {
+            samples += m_queue.front().batch_size;
+            batch.push_back(move(m_queue.front()));
+            m_queue.pop_front();
+        } while (!m_queue.empty() && can_batch_with(batch.front(), m_queue.front()) &&
+                 samples + m_queue.front().batch_size <= m_max_batch_size);
+
+        lock.unlock();
+        run_batch(batch);
+        lock.lock();
+    }
+}
+
+void runtime::dynamic::BatchingExecutable::run_batch(vector<Request>& batch)
+{
+    record_batch(batch, Clock::now());
+
+    bool result = false;
+    exception_ptr error;
+    try
+    {
+        if (batch.size() == 1)
+        {
+            result = m_executable->call(batch[0].outputs, batch[0].inputs);
+        }
+        else
+        {
+            size_t total_batch_size = 0;
+            for (const Request& request : batch)
+            {
+                total_batch_size += request.batch_size;
+            }
+
+            // Concatenate the inputs along the batch axis
+            vector<shared_ptr<runtime::Tensor>> inputs;
+            vector<char> src;
+            vector<char> dst;
+            for (size_t i = 0; i < batch[0].inputs.size(); i++)
+            {
+                const element::Type& type = batch[0].inputs[i]->get_element_type();
+                Shape shape = batch[0].inputs[i]->get_shape();
+                shape[m_batch_axis] = total_batch_size;
+                size_t outer = outer_size(shape, m_batch_axis);
+                size_t dst_block = inner_size(shape, m_batch_axis) * type.size();
+                dst.resize(shape_size(shape) * type.size());
+
+                size_t offset = 0;
+                for (const Request& request : batch)
+                {
+                    const shared_ptr<runtime::Tensor>& input = request.inputs[i];
+                    size_t src_block = inner_size(input->get_shape(), m_batch_axis) * type.size();
+                    src.resize(input->get_size_in_bytes());
+                    input->read(src.data(), 0, src.size());
+                    copy_blocks(
+                        dst.data() + offset, dst_block, src.data(), src_block, src_block, outer);
+                    offset += src_block;
+                }
+
+                auto input = m_backend->create_tensor(type, shape);
+                input->write(dst.data(), 0, dst.size());
+                inputs.push_back(input);
+            }
+
+            vector<shared_ptr<runtime::Tensor>> outputs;
+            for (size_t i = 0; i < get_results().size(); i++)
+            {
+                const shared_ptr<op::Result>& result_op = get_results()[i];
+                if (m_backend->supports_dynamic_tensors())
+                {
+                    outputs.push_back(
+                        m_backend->create_dynamic_tensor(result_op->get_output_element_type(0),
+                                                         result_op->get_output_partial_shape(0)));
+                }
+                else
+                {
+                    Shape shape = result_op->get_output_shape(0);
+                    shape[m_batch_axis] = total_batch_size;
+                    outputs.push_back(
+                        m_backend->create_tensor(result_op->get_output_element_type(0), shape));
+                }
+            }
+
+            result = m_executable->call(outputs, inputs);
+
+            // Scatter each caller's slice of the outputs
+            for (size_t i = 0; i < outputs.size(); i++)
+            {
+                const element::Type& type = outputs[i]->get_element_type();
+                const Shape& shape = outputs[i]->get_shape();
+                NGRAPH_CHECK(shape.size() > m_batch_axis &&
+                                 shape[m_batch_axis] == total_batch_size,
+                             "Output ",
+                             i,
+                             " of shape ",
+                             shape,
+                             " does not have the batch size ",
+                             total_batch_size,
+                             " of the batched inputs");
+                size_t outer = outer_size(shape, m_batch_axis);
+                size_t src_block = inner_size(shape, m_batch_axis) * type.size();
+                src.resize(outputs[i]->get_size_in_bytes());
+                outputs[i]->read(src.data(), 0, src.size());
+
+                size_t offset = 0;
+                for (const Request& request : batch)
+                {
+                    Shape slice_shape = shape;
+                    slice_shape[m_batch_axis] = request.batch_size;
+                    size_t dst_block = inner_size(slice_shape, m_batch_axis) * type.size();
+                    dst.resize(shape_size(slice_shape) * type.size());
+                    copy_blocks(
+                        dst.data(), dst_block, src.data() + offset, src_block, dst_block, outer);
+                    offset += dst_block;
+
+                    const shared_ptr<runtime::Tensor>& output = request.outputs[i];
+                    if (auto dynamic_output = dynamic_pointer_cast<DynamicTensor>(output))
+                    {
+                        dynamic_output->make_storage(type, slice_shape);
+                    }
+                    output->write(dst.data(), 0, dst.size());
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        result = false;
+        error = current_exception();
+    }
+
+    for (Request& request : batch)
+    {
+        request.callback(result, error);
+    }
+}
+
+void runtime::dynamic::BatchingExecutable::record_batch(const vector<Request>& batch,
+                                                        Clock::time_point dispatch_time)
+{
+    lock_guard<mutex> lock(m_stats_mutex);
+    size_t samples = 0;
+    for (const Request& request : batch)
+    {
+        samples += request.batch_size;
+
+        auto delay = chrono::duration_cast<chrono::microseconds>(dispatch_time -
+                                                                 request.enqueue_time);
+        size_t bucket = 0;
+        for (auto us = delay.count(); us > 0; us >>= 1)
+        {
+            bucket++;
+        }
+        if (m_queueing_delay_histogram.size() <= bucket)
+        {
+            m_queueing_delay_histogram.resize(bucket + 1, 0);
+        }
+        m_queueing_delay_histogram[bucket]++;
+        m_total_queueing_delay += delay;
+        m_max_queueing_delay = max(m_max_queueing_delay, delay);
+    }
+    if (m_batch_size_histogram.size() <= samples)
+    {
+        m_batch_size_histogram.resize(samples + 1, 0);
+    }
+    m_batch_size_histogram[samples]++;
+    m_batch_count++;
+    m_request_count += batch.size();
+}
+
+size_t runtime::dynamic::BatchingExecutable::get_batch_count() const
+{
+    lock_guard<mutex> lock(m_stats_mutex);
+    return m_batch_count;
+}
+
+size_t runtime::dynamic::BatchingExecutable::get_request_count() const
+{
+    lock_guard<mutex> lock(m_stats_mutex);
+    return m_request_count;
+}
+
+vector<size_t> runtime::dynamic::BatchingExecutable::get_batch_size_histogram() const
+{
+    lock_guard<mutex> lock(m_stats_mutex);
+    return m_batch_size_histogram;
+}
+
+vector<size_t> runtime::dynamic::BatchingExecutable::get_queueing_delay_histogram() const
+{
+    lock_guard<mutex> lock(m_stats_mutex);
+    return m_queueing_delay_histogram;
+}
+
+chrono::microseconds runtime::dynamic::BatchingExecutable::get_mean_queueing_delay() const
+{
+    lock_guard<mutex> lock(m_stats_mutex);
+    if (m_request_count == 0)
+    {
+        return chrono::microseconds(0);
+    }
+    return chrono::microseconds(m_total_queueing_delay.count() /
+                                static_cast<chrono::microseconds::rep>(m_request_count));
+}
+
+chrono::microseconds runtime::dynamic::BatchingExecutable::get_max_queueing_delay() const
+{
+    lock_guard<mutex> lock(m_stats_mutex);
+    return m_max_queueing_delay;
+}
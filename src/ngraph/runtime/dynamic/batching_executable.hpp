@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace dynamic
+        {
+            class BatchingExecutable;
+        }
+    }
+}
+
+///
+/// \brief Wrapper class that coalesces concurrent calls into batched calls of an Executable.
+///
+/// The wrapped executable must be compiled for a dynamic batch dimension, typically by a
+/// `DynamicBackend`, so that every parameter and result has the batch dimension at
+/// `batch_axis`. Each call is queued; a dispatcher thread waits until `max_batch_size` samples
+/// are queued or the oldest call has waited for `max_latency`, concatenates the inputs of the
+/// queued calls along the batch axis, calls the wrapped executable once and copies each
+/// caller's slice of the results into its output tensors.
+///
+/// Calls are batched together only when their inputs agree on element type and on every
+/// dimension but the batch axis. A call whose inputs carry several samples counts for that
+/// many samples. Exceptions thrown by the wrapped executable are reported to every call of
+/// the batch.
+///
+class ngraph::runtime::dynamic::BatchingExecutable : public ngraph::runtime::Executable
+{
+public:
+    /// \param backend backend that compiled `executable`, used to allocate batched tensors
+    /// \param executable executable compiled for a dynamic batch dimension
+    /// \param batch_axis axis of the batch dimension in all parameters and results
+    /// \param max_batch_size number of samples after which a batch is dispatched at once
+    /// \param max_latency time the oldest queued call waits for more calls to arrive
+    BatchingExecutable(std::shared_ptr<ngraph::runtime::Backend> backend,
+                       std::shared_ptr<ngraph::runtime::Executable> executable,
+                       size_t batch_axis,
+                       size_t max_batch_size,
+                       std::chrono::microseconds max_latency);
+    ~BatchingExecutable() override;
+
+    /// \brief Queues the call and blocks until its batch has been executed.
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief Queues the call and returns. The callback is invoked on the dispatcher thread.
+    void call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                    CallCallback callback) override;
+    using Executable::call_async;
+
+    size_t get_batch_axis() const { return m_batch_axis; }
+    size_t get_max_batch_size() const { return m_max_batch_size; }
+    std::chrono::microseconds get_max_latency() const { return m_max_latency; }
+    /// \brief Returns the number of batched calls made to the wrapped executable.
+    size_t get_batch_count() const;
+    /// \brief Returns the number of calls served.
+    size_t get_request_count() const;
+    /// \brief Returns the number of batches for each batch size in samples; element n counts
+    ///        the batches of n samples.
+    std::vector<size_t> get_batch_size_histogram() const;
+    /// \brief Returns the number of calls for each queueing delay, the time from a call being
+    ///        queued to its batch being dispatched. Element 0 counts delays below 1us and
+    ///        element n > 0 delays in [2^(n-1), 2^n) us.
+    std::vector<size_t> get_queueing_delay_histogram() const;
+    /// \brief Returns the mean queueing delay over all calls served.
+    std::chrono::microseconds get_mean_queueing_delay() const;
+    /// \brief Returns the largest queueing delay of any call served.
+    std::chrono::microseconds get_max_queueing_delay() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Request
+    {
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        CallCallback callback;
+        Clock::time_point enqueue_time;
+        size_t batch_size;
+    };
+
+    void dispatch_loop();
+    bool can_batch_with(const Request& first, const Request& request) const;
+    void run_batch(std::vector<Request>& batch);
+    void record_batch(const std::vector<Request>& batch, Clock::time_point dispatch_time);
+
+    std::shared_ptr<ngraph::runtime::Backend> m_backend;
+    std::shared_ptr<ngraph::runtime::Executable> m_executable;
+    size_t m_batch_axis;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_max_latency;
+
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_cv;
+    std::deque<Request> m_queue;
+    bool m_shutdown = false;
+    std::thread m_dispatcher;
+
+    mutable std::mutex m_stats_mutex;
+    size_t m_batch_count = 0;
+    size_t m_request_count = 0;
+    std::vector<size_t> m_batch_size_histogram;
+    std::vector<size_t> m_queueing_delay_histogram;
+    std::chrono::microseconds m_total_queueing_delay{0};
+    std::chrono::microseconds m_max_queueing_delay{0};
+};
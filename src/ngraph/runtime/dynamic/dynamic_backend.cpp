@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/pass/constant_folding.hpp"
@@ -26,6 +28,31 @@
 using namespace std;
 using namespace ngraph;
 
+// Evaluates the constant subgraphs handed over by ConstantFolding's generic step on the wrapped
+// backend
+static vector<shared_ptr<op::Constant>>
+    evaluate_on_backend(const shared_ptr<runtime::Backend>& backend, const shared_ptr<Function>& f)
+{
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (auto& result : f->get_results())
+    {
+        outputs.push_back(backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    auto executable = backend->compile(f);
+    executable->call(outputs, {});
+    backend->remove_compiled_function(executable);
+
+    vector<shared_ptr<op::Constant>> constants;
+    for (auto& output : outputs)
+    {
+        vector<char> data(output->get_size_in_bytes());
+        output->read(data.data(), 0, data.size());
+        constants.push_back(make_shared<op::Constant>(
+            output->get_element_type(), output->get_shape(), data.data()));
+    }
+    return constants;
+}
+
 runtime::dynamic::DynamicBackend::DynamicBackend(shared_ptr<runtime::Backend> wrapped_backend)
     : m_wrapped_backend(std::move(wrapped_backend))
 {
@@ -58,13 +85,21 @@ shared_ptr<runtime::Executable>
         function, m_wrapped_backend, enable_performance_collection);
 }
 
+constexpr size_t runtime::dynamic::DynamicExecutable::default_cache_capacity;
+
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
                                                        bool enable_performance_collection)
     : m_wrapped_function(wrapped_function)
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
+    , m_cache_capacity(default_cache_capacity)
 {
+    if (const char* env_cache_size = std::getenv("NGRAPH_DYNAMIC_EXECUTABLE_CACHE_SIZE"))
+    {
+        m_cache_capacity = std::strtoul(env_cache_size, nullptr, 10);
+    }
+
     pass::Manager passes;
     passes.register_pass<pass::ShapeRelevance>();
     passes.run_passes(m_wrapped_function);
@@ -72,84 +107,146 @@ runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrap
     set_parameters_and_results(*wrapped_function);
 }
 
+// Appends the raw bytes of a value to a cache key.
+template <typename T>
+static void append_to_key(std::string& key, const T& value)
+{
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
 bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
-
     NGRAPH_CHECK(m_wrapped_function->get_parameters().size() == inputs.size());
 
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
     std::vector<element::Type> arg_element_types;
     std::vector<PartialShape> arg_shapes;
 
-    std::shared_ptr<Function> clone;
-    {
-        // We'll use AlignedBuffers to back the base pointers, storing them in this vector for RAII
-        // purposes.
-        std::vector<AlignedBuffer> arg_buffers;
-        arg_buffers.reserve(inputs.size());
-        std::vector<void*> arg_value_base_pointers(inputs.size());
+    // We'll use AlignedBuffers to back the base pointers, storing them in this vector for RAII
+    // purposes.
+    std::vector<AlignedBuffer> arg_buffers;
+    arg_buffers.reserve(inputs.size());
+    std::vector<void*> arg_value_base_pointers(inputs.size());
 
-        size_t i = 0;
+    // The cache key is built from:
+    // (1) all element types and shapes;
+    // (2) all values of shape-relevant input tensors.
+    std::string key;
 
-        for (auto& input : inputs)
-        {
-            if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
-            {
-                // TODO(amprocte): Move has_storage() to runtime::Tensor?
-                if (auto dynamic_tensor =
-                        std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
-                {
-                    NGRAPH_CHECK(dynamic_tensor->has_storage());
-                }
-
-                arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
-                arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
-
-                // TODO(amprocte): For host-resident tensors we should be able to skip the read,
-                // but no API for that yet.
-                input->read(arg_value_base_pointers[i], 0, input->get_size_in_bytes());
-            }
-            else
-            {
-                arg_value_base_pointers[i] = nullptr;
-            }
+    size_t i = 0;
 
+    for (auto& input : inputs)
+    {
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+        {
+            // TODO(amprocte): Move has_storage() to runtime::Tensor?
             if (auto dynamic_tensor =
                     std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
             {
                 NGRAPH_CHECK(dynamic_tensor->has_storage());
-                arg_element_types.push_back(
-                    dynamic_tensor->get_wrapped_tensor()->get_element_type());
-                arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
-                wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
-            }
-            else
-            {
-                arg_element_types.push_back(input->get_element_type());
-                arg_shapes.push_back(input->get_shape());
-                wrapped_inputs.push_back(input);
             }
 
-            i++;
+            arg_buffers.emplace_back(input->get_size_in_bytes(), /*alignment=*/64);
+            arg_value_base_pointers[i] = arg_buffers.back().get_ptr();
+
+            // TODO(amprocte): For host-resident tensors we should be able to skip the read,
+            // but no API for that yet.
+            input->read(arg_value_base_pointers[i], 0, input->get_size_in_bytes());
+        }
+        else
+        {
+            arg_value_base_pointers[i] = nullptr;
         }
 
-        clone = specialize_function(
-            m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
+        if (auto dynamic_tensor =
+                std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+        {
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            arg_element_types.push_back(dynamic_tensor->get_wrapped_tensor()->get_element_type());
+            arg_shapes.push_back(dynamic_tensor->get_wrapped_tensor()->get_shape());
+            wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
+        {
+            arg_element_types.push_back(input->get_element_type());
+            arg_shapes.push_back(input->get_shape());
+            wrapped_inputs.push_back(input);
+        }
+
+        const Shape& shape = wrapped_inputs.back()->get_shape();
+        append_to_key(key, arg_element_types.back().get_type_enum());
+        append_to_key(key, shape.size());
+        for (size_t d : shape)
+        {
+            append_to_key(key, d);
+        }
+        if (arg_value_base_pointers[i] != nullptr)
+        {
+            key.append(static_cast<const char*>(arg_value_base_pointers[i]),
+                       input->get_size_in_bytes());
+        }
+
+        i++;
     }
 
-    pass::Manager passes;
-    passes.register_pass<pass::ConstantFolding>();
-    passes.register_pass<pass::DynElimination>();
-    passes.run_passes(clone);
+    std::shared_ptr<runtime::Executable> compiled_executable;
+    std::vector<element::Type> result_element_types;
+    std::vector<Shape> result_shapes;
+
+    {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        auto it = m_cache_map.find(key);
+        if (it != m_cache_map.end())
+        {
+            m_cache_hits++;
+            m_cache_lru.splice(m_cache_lru.begin(), m_cache_lru, it->second);
+            const CacheEntry& entry = it->second->second;
+            compiled_executable = entry.executable;
+            result_element_types = entry.result_element_types;
+            result_shapes = entry.result_shapes;
+        }
+        else
+        {
+            m_cache_misses++;
+        }
+    }
+
+    if (compiled_executable == nullptr)
+    {
+        auto clone = specialize_function(
+            m_wrapped_function, arg_element_types, arg_shapes, arg_value_base_pointers);
 
-    const ResultVector& results = clone->get_results();
-    NGRAPH_CHECK(results.size() == outputs.size());
+        pass::Manager passes;
+        auto wrapped_backend = m_wrapped_backend;
+        passes.register_pass<pass::ConstantFolding>(
+            BuildNodeExecutorMap(), true, [wrapped_backend](const shared_ptr<Function>& f) {
+                return evaluate_on_backend(wrapped_backend, f);
+            });
+        passes.register_pass<pass::DynElimination>();
+        passes.run_passes(clone);
+
+        for (auto& result : clone->get_results())
+        {
+            result_element_types.push_back(result->get_output_element_type(0));
+            result_shapes.push_back(result->get_output_shape(0));
+        }
+
+        compiled_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
+
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        // Another thread may have compiled the same clone concurrently; keep the first one.
+        if (m_cache_capacity > 0 && m_cache_map.find(key) == m_cache_map.end())
+        {
+            m_cache_lru.emplace_front(
+                key, CacheEntry{compiled_executable, result_element_types, result_shapes});
+            m_cache_map[key] = m_cache_lru.begin();
+            evict_to_capacity();
+        }
+    }
+
+    NGRAPH_CHECK(result_shapes.size() == outputs.size());
 
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
 
@@ -158,8 +255,7 @@ bool runtime::dynamic::DynamicExecutable::call(
         if (auto dynamic_tensor =
                 std::dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
         {
-            dynamic_tensor->make_storage(results[i]->get_output_element_type(0),
-                                         results[i]->get_output_shape(0));
+            dynamic_tensor->make_storage(result_element_types[i], result_shapes[i]);
             wrapped_outputs.push_back(dynamic_tensor->get_wrapped_tensor());
         }
         else
@@ -168,11 +264,61 @@ bool runtime::dynamic::DynamicExecutable::call(
         }
     }
 
-    // TODO: Put compiled executable in the cache.
-    auto compiled_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
-    auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
+    return compiled_executable->call(wrapped_outputs, wrapped_inputs);
+}
+
+void runtime::dynamic::DynamicExecutable::evict_to_capacity()
+{
+    while (m_cache_lru.size() > m_cache_capacity)
+    {
+        m_cache_map.erase(m_cache_lru.back().first);
+        m_cache_lru.pop_back();
+        m_cache_evictions++;
+    }
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_capacity() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_capacity;
+}
+
+void runtime::dynamic::DynamicExecutable::set_cache_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    m_cache_capacity = capacity;
+    evict_to_capacity();
+}
 
-    return result;
+size_t runtime::dynamic::DynamicExecutable::get_cache_size() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_lru.size();
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_hit_count() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_hits;
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_miss_count() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_misses;
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_eviction_count() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_evictions;
+}
+
+void runtime::dynamic::DynamicExecutable::clear_cache()
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    m_cache_map.clear();
+    m_cache_lru.clear();
 }
 
 runtime::dynamic::DynamicTensor::DynamicTensor(
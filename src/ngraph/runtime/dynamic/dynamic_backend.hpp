@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/runtime/backend.hpp"
@@ -86,6 +89,12 @@ private:
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// Steps 1 and 2 are skipped when a compatible clone has already been compiled. Compiled clones
+/// are kept in a bounded LRU cache keyed on the element types and shapes of all inputs, plus the
+/// values of all inputs that are relevant to shapes. The capacity of the cache defaults to
+/// `DynamicExecutable::default_cache_capacity`, and may be overridden with the environment
+/// variable `NGRAPH_DYNAMIC_EXECUTABLE_CACHE_SIZE`. A capacity of zero disables caching.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
@@ -97,10 +106,47 @@ public:
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    static constexpr size_t default_cache_capacity = 32;
+
+    /// \brief Returns the maximum number of compiled clones kept in the cache.
+    size_t get_cache_capacity() const;
+    /// \brief Sets the maximum number of compiled clones kept in the cache, evicting the least
+    ///        recently used entries if the cache currently holds more than `capacity` entries.
+    void set_cache_capacity(size_t capacity);
+    /// \brief Returns the number of compiled clones currently held in the cache.
+    size_t get_cache_size() const;
+    /// \brief Returns the number of calls that reused a cached compiled clone.
+    size_t get_cache_hit_count() const;
+    /// \brief Returns the number of calls that had to specialize and compile a new clone.
+    size_t get_cache_miss_count() const;
+    /// \brief Returns the number of compiled clones dropped from the cache to respect its capacity.
+    size_t get_cache_eviction_count() const;
+    /// \brief Drops all cached compiled clones. Counters are left untouched.
+    void clear_cache();
+
 private:
+    struct CacheEntry
+    {
+        std::shared_ptr<runtime::Executable> executable;
+        std::vector<element::Type> result_element_types;
+        std::vector<Shape> result_shapes;
+    };
+    using CacheList = std::list<std::pair<std::string, CacheEntry>>;
+
+    void evict_to_capacity();
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     bool m_enable_performance_collection;
+
+    // Most recently used entries are at the front of m_cache_lru.
+    mutable std::mutex m_cache_mutex;
+    size_t m_cache_capacity;
+    CacheList m_cache_lru;
+    std::unordered_map<std::string, CacheList::iterator> m_cache_map;
+    size_t m_cache_hits{0};
+    size_t m_cache_misses{0};
+    size_t m_cache_evictions{0};
 };
 
 ///
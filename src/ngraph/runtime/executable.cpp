@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <sstream>
+#include <thread>
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/executable.hpp"
@@ -39,6 +40,44 @@ bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Te
     return call(outputs, inputs);
 }
 
+void runtime::Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                     const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                     CallCallback callback)
+{
+    thread worker([this, outputs, inputs, callback]() {
+        bool result = false;
+        exception_ptr error;
+        try
+        {
+            result = call(outputs, inputs);
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+        callback(result, error);
+    });
+    worker.detach();
+}
+
+future<bool> runtime::Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    auto promise = make_shared<std::promise<bool>>();
+    future<bool> rc = promise->get_future();
+    call_async(outputs, inputs, [promise](bool result, exception_ptr error) {
+        if (error)
+        {
+            promise->set_exception(error);
+        }
+        else
+        {
+            promise->set_value(result);
+        }
+    });
+    return rc;
+}
+
 void runtime::Executable::validate(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                    const vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
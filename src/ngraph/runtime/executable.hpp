@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 
 #include "ngraph/function.hpp"
@@ -35,6 +38,12 @@ namespace ngraph
 class ngraph::runtime::Executable
 {
 public:
+    /// \brief Callback invoked when an asynchronous call completes.
+    ///
+    /// `result` is the value returned by the call. If the call threw, `result` is false and
+    /// `error` holds the exception; otherwise `error` is null.
+    using CallCallback = std::function<void(bool result, std::exception_ptr error)>;
+
     Executable();
     virtual ~Executable();
 
@@ -51,6 +60,29 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Starts a single iteration of a Function without blocking the calling thread.
+    ///
+    /// The Executable must outlive the call. The input tensors must not be modified, and the
+    /// output tensors must not be accessed, until the callback has been invoked. The default
+    /// implementation runs `call` on a new thread; backends may override this to schedule the
+    /// call on their own execution resources.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \param callback invoked on completion, on the thread that executed the call
+    virtual void call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                            const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                            CallCallback callback);
+
+    /// \brief Starts a single iteration of a Function without blocking the calling thread.
+    ///
+    /// Same as the callback variant, with completion reported through a future.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \returns a future holding the value returned by the call. Exceptions thrown by the call
+    ///     are rethrown by `std::future::get`.
+    std::future<bool> call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
@@ -50,6 +50,22 @@ runtime::gcpu::GCPUExecutable::GCPUExecutable(const shared_ptr<Function>& functi
         }
     }
     set_parameters_and_results(*function);
+
+    vector<const Node*> ops;
+    for (const NodeWrapper& wrapped : m_wrapped_nodes)
+    {
+        ops.push_back(&wrapped.get_node());
+        if (m_performance_counters_enabled)
+        {
+            // Create all timers up front so that concurrent ops only look them up
+            m_timer_map[&wrapped.get_node()];
+        }
+    }
+    size_t num_threads = OpScheduler::get_default_num_threads();
+    if (num_threads > 1)
+    {
+        m_scheduler.reset(new OpScheduler(OpScheduler::get_successors(ops), num_threads));
+    }
 }
 
 bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
@@ -99,9 +115,16 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
+    // Resolve the tensors and element type of every op before running any of them, so that
+    // the ops can be executed concurrently
+    vector<vector<shared_ptr<HostTensor>>> all_op_inputs(m_wrapped_nodes.size());
+    vector<vector<shared_ptr<HostTensor>>> all_op_outputs(m_wrapped_nodes.size());
+    vector<element::Type> op_types(m_wrapped_nodes.size());
+
     // for each ordered op in the graph
-    for (const NodeWrapper& wrapped : m_wrapped_nodes)
+    for (size_t op_index = 0; op_index < m_wrapped_nodes.size(); ++op_index)
     {
+        const NodeWrapper& wrapped = m_wrapped_nodes[op_index];
         const Node* op = &wrapped.get_node();
         auto type_id = wrapped.get_typeid();
         if (type_id == OP_TYPEID::Parameter)
@@ -110,7 +133,7 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         }
 
         // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
+        vector<shared_ptr<HostTensor>>& op_inputs = all_op_inputs[op_index];
         for (const descriptor::Input& input : op->get_inputs())
         {
             descriptor::Tensor* tensor = input.get_output().get_tensor_ptr().get();
@@ -118,7 +141,7 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         }
 
         // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
+        vector<shared_ptr<HostTensor>>& op_outputs = all_op_outputs[op_index];
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = op->get_output_tensor_ptr(i).get();
@@ -140,7 +163,7 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         }
 
         // get op type
-        element::Type type;
+        element::Type& type = op_types[op_index];
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-enum"
         switch (type_id)
@@ -165,20 +188,41 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         default: type = op->get_output_element_type(0); break;
         }
 #pragma GCC diagnostic pop
+    }
 
+    auto execute_op = [&](size_t op_index) {
+        const NodeWrapper& wrapped = m_wrapped_nodes[op_index];
+        const Node* op = &wrapped.get_node();
+        if (wrapped.get_typeid() == OP_TYPEID::Parameter)
+        {
+            return;
+        }
+        const vector<shared_ptr<HostTensor>>& op_outputs = all_op_outputs[op_index];
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].start();
+            m_timer_map.at(op).start();
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs);
+        generate_calls(op_types[op_index], wrapped, op_outputs, all_op_inputs[op_index]);
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].stop();
+            m_timer_map.at(op).stop();
         }
         if (m_nan_check_enabled)
         {
             perform_nan_check(op_outputs, op);
         }
+    };
+
+    if (m_scheduler)
+    {
+        m_scheduler->run(execute_op);
+    }
+    else
+    {
+        for (size_t op_index = 0; op_index < m_wrapped_nodes.size(); ++op_index)
+        {
+            execute_op(op_index);
+        }
     }
 
     return true;
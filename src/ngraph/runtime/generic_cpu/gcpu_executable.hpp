@@ -18,6 +18,7 @@
 
 #include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -64,6 +65,7 @@
 #include "ngraph/runtime/generic_cpu/kernel/reshape.hpp"
 #include "ngraph/runtime/generic_cpu/node_wrapper.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/op_scheduler.hpp"
 #include "ngraph/runtime/interpreter/node_wrapper.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/acos.hpp"
@@ -163,6 +165,10 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Returns the number of threads used to run independent ops concurrently, as
+    ///        set by NGRAPH_INTER_OP_THREADS at compile time.
+    size_t get_num_threads() const { return m_scheduler ? m_scheduler->get_num_threads() : 1; }
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
 private:
@@ -172,7 +178,9 @@ private:
     std::unordered_map<const Node*, stopwatch> m_timer_map;
     std::vector<NodeWrapper> m_wrapped_nodes;
     std::unordered_map<const Node*, std::shared_ptr<RNGState>> m_states;
+    std::mutex m_states_mutex;
     std::set<std::string> m_unsupported_op_name_list;
+    std::unique_ptr<OpScheduler> m_scheduler;
 
     int get_alignment() const { return 64; }
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
@@ -345,15 +353,20 @@ private:
         }
         case OP_TYPEID::GenerateMask:
         {
-            if (m_states.count(&node) == 0)
+            ngraph::RNGState* state;
             {
-                const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
-                m_states[&node] = std::unique_ptr<ngraph::RNGState>(
-                    ngraph::RNGState::create_rng_state(gm->get_seed(), gm->get_probability()));
+                // Independent ops may run concurrently
+                std::lock_guard<std::mutex> lock(m_states_mutex);
+                if (m_states.count(&node) == 0)
+                {
+                    const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
+                    m_states[&node] = std::unique_ptr<ngraph::RNGState>(
+                        ngraph::RNGState::create_rng_state(gm->get_seed(), gm->get_probability()));
+                }
+                state = m_states.at(&node).get();
             }
 
             bool training = static_cast<bool>(static_cast<const T*>(args[0])[0]);
-            auto state = m_states.at(&node).get();
             size_t element_count = shape_size(node.get_output_shape(0));
             reference::generate_mask<T>(
                 reinterpret_cast<T*>(out[0]), element_count, state, training);
@@ -57,6 +57,7 @@ public:
     std::shared_ptr<Executable> load(std::istream& input_stream) override;
 
     bool is_supported(const Node& node) const override;
+    bool is_supported_property(const Property prop) const override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <unordered_set>
+
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
@@ -28,6 +30,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -42,12 +45,19 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     : m_is_compiled{true}
     , m_performance_counters_enabled{enable_performance_collection}
 {
+    size_t num_threads = OpScheduler::get_default_num_threads();
     m_function = clone_function(*function);
     pass::Manager pass_manager;
     pass_manager.register_pass<pass::LikeReplacement>();
     pass_manager.register_pass<pass::FusedOpDecomposition>();
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+    if (num_threads == 1)
+    {
+        pass_manager.register_pass<pass::MemorySchedule>();
+    }
     pass_manager.register_pass<pass::Liveness>();
+    // Ops that run concurrently must not share memory
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment(), num_threads > 1);
     pass_manager.run_passes(m_function);
 
     for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
@@ -55,118 +65,125 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         m_wrapped_nodes.emplace_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_tensor_tables();
+    build_scheduler(num_threads);
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
     : m_is_compiled{true}
     , m_performance_counters_enabled{false}
 {
+    size_t num_threads = OpScheduler::get_default_num_threads();
     m_function = deserialize(model_string);
+    pass::Manager pass_manager;
+    if (num_threads == 1)
+    {
+        pass_manager.register_pass<pass::MemorySchedule>();
+    }
+    pass_manager.register_pass<pass::Liveness>();
+    // Ops that run concurrently must not share memory
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment(), num_threads > 1);
+    pass_manager.run_passes(m_function);
+
     for (const shared_ptr<Node>& node : m_function->get_ordered_ops())
     {
         m_wrapped_nodes.emplace_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_tensor_tables();
+    build_scheduler(num_threads);
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::build_tensor_tables()
 {
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
-    }
-    if (m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
-    }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
-    }
-
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
+    // Function parameters and results are supplied by the caller. A parameter may be listed
+    // more than once; its first position is used.
+    unordered_map<descriptor::Tensor*, size_t> external_tensors;
+    size_t external_index = 0;
     for (auto param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            external_tensors.insert({&param->output(i).get_tensor(), external_index++});
         }
     }
-
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    for (auto result : get_results())
     {
-        auto output = get_results()[output_count];
-        if (!dynamic_pointer_cast<op::Result>(output))
+        if (!dynamic_pointer_cast<op::Result>(result))
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::Tensor* tensor = &output->output(0).get_tensor();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        external_tensors.insert({&result->output(0).get_tensor(), external_index++});
     }
 
-    // for each ordered op in the graph
+    // Tensors planned by MemoryLayout live in the arena. Constants are persistent and are
+    // not planned, so they get their own storage.
+    unordered_set<descriptor::Tensor*> arena_tensors;
     for (const NodeWrapper& wrapped : m_wrapped_nodes)
     {
+        const auto& new_list = wrapped.get_node()->liveness_new_list;
+        arena_tensors.insert(new_list.begin(), new_list.end());
+    }
+
+    unordered_map<descriptor::Tensor*, size_t> internal_index;
+    m_op_input_count.resize(m_wrapped_nodes.size(), 0);
+    m_op_output_count.resize(m_wrapped_nodes.size(), 0);
+    m_op_types.resize(m_wrapped_nodes.size());
+    for (size_t op_index = 0; op_index < m_wrapped_nodes.size(); ++op_index)
+    {
+        const NodeWrapper& wrapped = m_wrapped_nodes[op_index];
         auto op = wrapped.get_node();
-        auto type_id = wrapped.get_typeid();
-        if (type_id == OP_TYPEID::Parameter)
+        if (wrapped.get_typeid() == OP_TYPEID::Parameter)
         {
             continue;
         }
 
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
         for (auto input : op->inputs())
         {
             descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            size_t position = m_op_input_count[op_index]++;
+            auto it = external_tensors.find(tensor);
+            if (it != external_tensors.end())
+            {
+                m_external_slots.push_back({op_index, false, position, it->second});
+            }
+            else
+            {
+                m_internal_slots.push_back({op_index, false, position, internal_index.at(tensor)});
+            }
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            m_op_output_count[op_index]++;
+            auto it = external_tensors.find(tensor);
+            if (it != external_tensors.end())
             {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
+                m_external_slots.push_back({op_index, true, i, it->second});
+                continue;
             }
-            else
-            {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
+
+            bool in_arena = arena_tensors.count(tensor) != 0;
+            internal_index.insert({tensor, m_internal_tensors.size()});
+            m_internal_slots.push_back({op_index, true, i, m_internal_tensors.size()});
+            m_internal_tensors.push_back({op->get_output_element_type(i),
+                                          op->get_output_shape(i),
+                                          tensor->get_name(),
+                                          in_arena,
+                                          in_arena ? tensor->get_pool_offset() : 0});
         }
 
         // get op type
-        element::Type type;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wswitch-enum"
-        switch (type_id)
+        switch (wrapped.get_typeid())
         {
         case OP_TYPEID::Convert:
         case OP_TYPEID::Quantize:
         case OP_TYPEID::Dequantize:
         case OP_TYPEID::ArgMin:
-        case OP_TYPEID::ArgMax: type = op->get_input_element_type(0); break;
+        case OP_TYPEID::ArgMax: m_op_types[op_index] = op->get_input_element_type(0); break;
         case OP_TYPEID::Equal:
         case OP_TYPEID::Greater:
         case OP_TYPEID::GreaterEq:
@@ -176,31 +193,183 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
             // Get the type of the second input, not the first
             // All BinaryElementwiseComparision ops have the same type for inputs
             // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            m_op_types[op_index] = op->get_input_element_type(1);
             break;
-        case OP_TYPEID::TopK: type = op->get_output_element_type(1); break;
-        default: type = op->get_output_element_type(0); break;
+        case OP_TYPEID::TopK: m_op_types[op_index] = op->get_output_element_type(1); break;
+        default: m_op_types[op_index] = op->get_output_element_type(0); break;
         }
 #pragma GCC diagnostic pop
+    }
+}
 
+void runtime::interpreter::INTExecutable::build_scheduler(size_t num_threads)
+{
+    vector<const Node*> ops;
+    for (const NodeWrapper& wrapped : m_wrapped_nodes)
+    {
+        ops.push_back(wrapped.get_node().get());
         if (m_performance_counters_enabled)
         {
-            m_timer_map[op].start();
+            // Create all timers up front so that concurrent ops only look them up
+            m_timer_map[wrapped.get_node()];
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs);
-        if (m_performance_counters_enabled)
+    }
+    m_num_threads = num_threads;
+    if (num_threads > 1)
+    {
+        m_successors = OpScheduler::get_successors(ops);
+    }
+
+    // Most executables are only ever called from one thread at a time
+    release_call_context(acquire_call_context());
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallContext>
+    runtime::interpreter::INTExecutable::acquire_call_context()
+{
+    {
+        lock_guard<mutex> lock(m_contexts_mutex);
+        if (!m_free_contexts.empty())
         {
-            m_timer_map[op].stop();
+            unique_ptr<CallContext> context = move(m_free_contexts.back());
+            m_free_contexts.pop_back();
+            return context;
         }
-        if (m_nan_check_enabled)
+    }
+
+    unique_ptr<CallContext> context(new CallContext());
+    context->arena = AlignedBuffer(m_function->get_temporary_pool_size(), get_alignment());
+    vector<shared_ptr<HostTensor>> tensors;
+    for (const InternalTensor& t : m_internal_tensors)
+    {
+        if (t.in_arena)
         {
-            perform_nan_check(op_outputs, op.get());
+            void* memory = context->arena.get_ptr(t.offset);
+            tensors.push_back(make_shared<runtime::HostTensor>(t.type, t.shape, memory, t.name));
+        }
+        else
+        {
+            tensors.push_back(make_shared<runtime::HostTensor>(t.type, t.shape, t.name));
         }
     }
+    context->op_inputs.resize(m_wrapped_nodes.size());
+    context->op_outputs.resize(m_wrapped_nodes.size());
+    for (size_t op_index = 0; op_index < m_wrapped_nodes.size(); ++op_index)
+    {
+        context->op_inputs[op_index].resize(m_op_input_count[op_index]);
+        context->op_outputs[op_index].resize(m_op_output_count[op_index]);
+    }
+    for (const TensorSlot& slot : m_internal_slots)
+    {
+        auto& table = slot.is_output ? context->op_outputs : context->op_inputs;
+        table[slot.op_index][slot.position] = tensors[slot.tensor_index];
+    }
+    if (m_num_threads > 1)
+    {
+        context->scheduler.reset(new OpScheduler(m_successors, m_num_threads));
+    }
+    return context;
+}
+
+void runtime::interpreter::INTExecutable::release_call_context(unique_ptr<CallContext> context)
+{
+    lock_guard<mutex> lock(m_contexts_mutex);
+    m_free_contexts.push_back(move(context));
+}
+
+void runtime::interpreter::INTExecutable::bind_external_tensors(
+    CallContext& context,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    for (const TensorSlot& slot : m_external_slots)
+    {
+        const shared_ptr<runtime::Tensor>& tensor =
+            slot.tensor_index < inputs.size() ? inputs[slot.tensor_index]
+                                              : outputs[slot.tensor_index - inputs.size()];
+        auto& table = slot.is_output ? context.op_outputs : context.op_inputs;
+        table[slot.op_index][slot.position] = static_pointer_cast<runtime::HostTensor>(tensor);
+    }
+}
+
+void runtime::interpreter::INTExecutable::release_external_tensors(CallContext& context)
+{
+    // Don't keep the caller's tensors alive between calls
+    for (const TensorSlot& slot : m_external_slots)
+    {
+        auto& table = slot.is_output ? context.op_outputs : context.op_inputs;
+        table[slot.op_index][slot.position] = nullptr;
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> func_inputs;
+        for (auto tensor : inputs)
+        {
+            func_inputs.push_back(static_pointer_cast<runtime::HostTensor>(tensor));
+        }
+        perform_nan_check(func_inputs);
+    }
+
+    unique_ptr<CallContext> context = acquire_call_context();
+    bind_external_tensors(*context, outputs, inputs);
+    try
+    {
+        if (context->scheduler)
+        {
+            CallContext& ctx = *context;
+            context->scheduler->run([this, &ctx](size_t op_index) { execute_op(ctx, op_index); });
+        }
+        else
+        {
+            // for each ordered op in the graph
+            for (size_t op_index = 0; op_index < m_wrapped_nodes.size(); ++op_index)
+            {
+                execute_op(*context, op_index);
+            }
+        }
+    }
+    catch (...)
+    {
+        release_external_tensors(*context);
+        release_call_context(move(context));
+        throw;
+    }
+    release_external_tensors(*context);
+    release_call_context(move(context));
 
     return true;
 }
 
+void runtime::interpreter::INTExecutable::execute_op(CallContext& context, size_t op_index)
+{
+    const NodeWrapper& wrapped = m_wrapped_nodes[op_index];
+    if (wrapped.get_typeid() == OP_TYPEID::Parameter)
+    {
+        return;
+    }
+
+    auto op = wrapped.get_node();
+    const vector<shared_ptr<HostTensor>>& op_outputs = context.op_outputs[op_index];
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).start();
+    }
+    generate_calls(m_op_types[op_index], wrapped, op_outputs, context.op_inputs[op_index]);
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(op_outputs, op.get());
+    }
+}
+
 void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
                                                          const NodeWrapper& op,
                                                          const vector<shared_ptr<HostTensor>>& out,
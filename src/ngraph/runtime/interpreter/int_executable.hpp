@@ -18,6 +18,7 @@
 
 #include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -65,6 +66,7 @@
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/hybrid/op/function_call.hpp"
 #include "ngraph/runtime/interpreter/node_wrapper.hpp"
+#include "ngraph/runtime/op_scheduler.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
@@ -173,6 +175,11 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Returns the number of threads used to run independent ops concurrently. This
+    ///        is taken from NGRAPH_INTER_OP_THREADS at compile time; with more than one thread
+    ///        intermediate tensors no longer share memory.
+    size_t get_num_threads() const { return m_num_threads; }
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
 private:
@@ -186,8 +193,60 @@ private:
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<NodeWrapper> m_wrapped_nodes;
     std::unordered_map<const Node*, std::shared_ptr<RNGState>> m_states;
+    std::mutex m_states_mutex;
     std::set<std::string> m_unsupported_op_name_list;
 
+    // Tensors of each node in m_wrapped_nodes, resolved once at compile time. A slot is an
+    // input or output position of an op. Intermediate tensors are views into the arena of a
+    // CallContext at the offsets assigned by pass::MemoryLayout; slots that refer to function
+    // parameters or results are empty and are filled from the call's arguments.
+    struct TensorSlot
+    {
+        size_t op_index;
+        bool is_output;
+        size_t position;
+        size_t tensor_index; // external: inputs first, then outputs; else m_internal_tensors
+    };
+    struct InternalTensor
+    {
+        element::Type type;
+        Shape shape;
+        std::string name;
+        bool in_arena;
+        size_t offset;
+    };
+    std::vector<InternalTensor> m_internal_tensors;
+    std::vector<TensorSlot> m_internal_slots;
+    std::vector<TensorSlot> m_external_slots;
+    std::vector<size_t> m_op_input_count;
+    std::vector<size_t> m_op_output_count;
+    std::vector<element::Type> m_op_types;
+
+    // Storage and tensor tables of one call in flight. Calls take a free context from the
+    // pool, or build a new one, and return it when they are done, so concurrent calls never
+    // share intermediate memory.
+    struct CallContext
+    {
+        AlignedBuffer arena;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> op_inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> op_outputs;
+        std::unique_ptr<OpScheduler> scheduler;
+    };
+    std::vector<std::unique_ptr<CallContext>> m_free_contexts;
+    std::mutex m_contexts_mutex;
+    std::vector<std::vector<size_t>> m_successors;
+    size_t m_num_threads = 1;
+
+    void build_tensor_tables();
+    void build_scheduler(size_t num_threads);
+    std::unique_ptr<CallContext> acquire_call_context();
+    void release_call_context(std::unique_ptr<CallContext> context);
+    void execute_op(CallContext& context, size_t op_index);
+    void bind_external_tensors(CallContext& context,
+                               const std::vector<std::shared_ptr<Tensor>>& outputs,
+                               const std::vector<std::shared_ptr<Tensor>>& inputs);
+    void release_external_tensors(CallContext& context);
+
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
@@ -357,15 +416,20 @@ private:
         }
         case OP_TYPEID::GenerateMask:
         {
-            if (m_states.count(&node) == 0)
+            ngraph::RNGState* state;
             {
-                const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
-                m_states[&node] = std::unique_ptr<ngraph::RNGState>(
-                    ngraph::RNGState::create_rng_state(gm->get_seed(), gm->get_probability()));
+                // Independent ops may run concurrently
+                std::lock_guard<std::mutex> lock(m_states_mutex);
+                if (m_states.count(&node) == 0)
+                {
+                    const op::GenerateMask* gm = static_cast<const op::GenerateMask*>(&node);
+                    m_states[&node] = std::unique_ptr<ngraph::RNGState>(
+                        ngraph::RNGState::create_rng_state(gm->get_seed(), gm->get_probability()));
+                }
+                state = m_states.at(&node).get();
             }
 
             bool training = static_cast<bool>(args[0]->get_data_ptr<const T>()[0]);
-            auto state = m_states.at(&node).get();
             size_t element_count = shape_size(node.get_output_shape(0));
             reference::generate_mask<T>(out[0]->get_data_ptr<T>(), element_count, state, training);
             break;
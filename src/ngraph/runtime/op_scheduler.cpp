@@ -0,0 +1,268 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+
+#include "ngraph/runtime/op_scheduler.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::OpScheduler::OpScheduler(const vector<vector<size_t>>& successors, size_t num_threads)
+    : m_successors(successors)
+    , m_predecessor_count(successors.size(), 0)
+    , m_pending(new atomic<size_t>[successors.size()])
+{
+    NGRAPH_CHECK(num_threads > 0, "OpScheduler needs at least one thread");
+    for (const vector<size_t>& op_successors : m_successors)
+    {
+        for (size_t successor : op_successors)
+        {
+            NGRAPH_CHECK(successor < m_successors.size(), "Successor index out of range");
+            m_predecessor_count[successor]++;
+        }
+    }
+
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        m_workers.emplace_back(new Worker());
+    }
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        m_threads.emplace_back(&OpScheduler::worker_loop, this, i);
+    }
+}
+
+runtime::OpScheduler::~OpScheduler()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_work_cv.notify_all();
+    for (thread& t : m_threads)
+    {
+        t.join();
+    }
+}
+
+vector<vector<size_t>> runtime::OpScheduler::get_successors(const vector<const Node*>& ops)
+{
+    unordered_map<const Node*, size_t> op_index;
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        op_index.insert({ops[i], i});
+    }
+
+    vector<vector<size_t>> successors(ops.size());
+    auto add_edge = [&](const Node* from, size_t to) {
+        auto it = op_index.find(from);
+        if (it != op_index.end() && (successors[it->second].empty() ||
+                                     successors[it->second].back() != to))
+        {
+            successors[it->second].push_back(to);
+        }
+    };
+
+    const Node* last_collective = nullptr;
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        const Node* op = ops[i];
+        for (const Input<const Node>& input : op->inputs())
+        {
+            add_edge(input.get_source_output().get_node(), i);
+        }
+        for (const shared_ptr<Node>& control_dep : op->get_control_dependencies())
+        {
+            add_edge(control_dep.get(), i);
+        }
+        if (dynamic_cast<const op::AllReduce*>(op) ||
+            dynamic_cast<const op::BroadcastDistributed*>(op))
+        {
+            if (last_collective)
+            {
+                add_edge(last_collective, i);
+            }
+            last_collective = op;
+        }
+    }
+    return successors;
+}
+
+size_t runtime::OpScheduler::get_default_num_threads()
+{
+    size_t num_threads = 1;
+    if (const char* env = getenv("NGRAPH_INTER_OP_THREADS"))
+    {
+        num_threads = max<size_t>(1, strtoul(env, nullptr, 10));
+    }
+    return num_threads;
+}
+
+void runtime::OpScheduler::run(const function<void(size_t)>& execute)
+{
+    lock_guard<mutex> run_lock(m_run_mutex);
+    if (m_successors.empty())
+    {
+        return;
+    }
+
+    m_execute = &execute;
+    m_error = nullptr;
+    m_failed = false;
+    m_remaining = m_successors.size();
+    for (size_t op = 0; op < m_successors.size(); ++op)
+    {
+        m_pending[op] = m_predecessor_count[op];
+    }
+
+    size_t next_worker = 0;
+    for (size_t op = 0; op < m_successors.size(); ++op)
+    {
+        if (m_predecessor_count[op] == 0)
+        {
+            push(next_worker, op);
+            next_worker = (next_worker + 1) % m_workers.size();
+        }
+    }
+
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_done_cv.wait(lock, [this] { return m_remaining == 0; });
+    }
+    m_execute = nullptr;
+
+    if (m_error)
+    {
+        rethrow_exception(m_error);
+    }
+}
+
+void runtime::OpScheduler::push(size_t worker, size_t op)
+{
+    m_queued++;
+    {
+        lock_guard<mutex> lock(m_workers[worker]->mutex);
+        m_workers[worker]->tasks.push_back(op);
+    }
+    // A worker announces itself in m_sleeping before checking m_queued under m_mutex, so
+    // either it sees this op or we see it and wake it
+    if (m_sleeping > 0)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_work_cv.notify_one();
+    }
+}
+
+bool runtime::OpScheduler::pop(size_t worker, size_t& op)
+{
+    {
+        lock_guard<mutex> lock(m_workers[worker]->mutex);
+        deque<size_t>& tasks = m_workers[worker]->tasks;
+        if (tasks.empty())
+        {
+            return false;
+        }
+        op = tasks.back();
+        tasks.pop_back();
+    }
+    m_queued--;
+    return true;
+}
+
+bool runtime::OpScheduler::steal(size_t worker, size_t& op)
+{
+    for (size_t i = 1; i < m_workers.size(); ++i)
+    {
+        size_t victim = (worker + i) % m_workers.size();
+        {
+            lock_guard<mutex> lock(m_workers[victim]->mutex);
+            deque<size_t>& tasks = m_workers[victim]->tasks;
+            if (tasks.empty())
+            {
+                continue;
+            }
+            op = tasks.front();
+            tasks.pop_front();
+        }
+        m_queued--;
+        return true;
+    }
+    return false;
+}
+
+void runtime::OpScheduler::execute_op(size_t worker, size_t op)
+{
+    // After a failure the remaining ops are only retired so that run() can return
+    if (!m_failed)
+    {
+        try
+        {
+            (*m_execute)(op);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (!m_error)
+            {
+                m_error = current_exception();
+            }
+            m_failed = true;
+        }
+    }
+
+    for (size_t successor : m_successors[op])
+    {
+        if (--m_pending[successor] == 0)
+        {
+            push(worker, successor);
+        }
+    }
+
+    if (--m_remaining == 0)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_done_cv.notify_all();
+    }
+}
+
+void runtime::OpScheduler::worker_loop(size_t worker)
+{
+    while (true)
+    {
+        size_t op;
+        if (pop(worker, op) || steal(worker, op))
+        {
+            execute_op(worker, op);
+            continue;
+        }
+
+        unique_lock<mutex> lock(m_mutex);
+        m_sleeping++;
+        m_work_cv.wait(lock, [this] { return m_shutdown || m_queued > 0; });
+        m_sleeping--;
+        if (m_shutdown)
+        {
+            return;
+        }
+    }
+}
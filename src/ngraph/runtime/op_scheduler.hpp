@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    class Node;
+
+    namespace runtime
+    {
+        class OpScheduler;
+    }
+}
+
+/// \brief Runs the ops of a dependency graph on a pool of worker threads.
+///
+/// Ops are identified by their index. An op becomes ready once all of its predecessors have
+/// finished and is then pushed onto the deque of the worker that released it. Workers pop
+/// their own deque LIFO and steal FIFO from the other workers when it runs dry.
+///
+/// Each op is executed exactly once per `run` by a single thread, so the outputs of an op are
+/// the same as with sequential execution as long as ops that may run concurrently do not
+/// share memory.
+class ngraph::runtime::OpScheduler
+{
+public:
+    /// \param successors successors[i] lists the ops that may only start after op i finished
+    /// \param num_threads number of worker threads
+    OpScheduler(const std::vector<std::vector<size_t>>& successors, size_t num_threads);
+    ~OpScheduler();
+
+    /// \brief Builds the successor lists for ops given in topological order. An op depends on
+    ///        the producers of its inputs and on its control dependencies. Collective ops such
+    ///        as AllReduce additionally keep their relative order so that all ranks issue them
+    ///        in the same sequence.
+    static std::vector<std::vector<size_t>> get_successors(const std::vector<const Node*>& ops);
+
+    /// \brief Returns the inter-op thread count requested through the environment variable
+    ///        NGRAPH_INTER_OP_THREADS, or 1 when it is not set.
+    static size_t get_default_num_threads();
+
+    size_t get_num_threads() const { return m_threads.size(); }
+    /// \brief Calls `execute` for every op, respecting dependencies, and blocks until all ops
+    ///        finished. Once an op throws, the remaining ops are skipped and the first
+    ///        exception is rethrown. Concurrent calls to `run` are serialized.
+    void run(const std::function<void(size_t)>& execute);
+
+private:
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    void push(size_t worker, size_t op);
+    bool pop(size_t worker, size_t& op);
+    bool steal(size_t worker, size_t& op);
+    void execute_op(size_t worker, size_t op);
+    void worker_loop(size_t worker);
+
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<size_t> m_predecessor_count;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_run_mutex;
+    // Only taken to sleep, to wake sleeping workers and to report completion or errors
+    std::mutex m_mutex;
+    std::condition_variable m_work_cv;
+    std::condition_variable m_done_cv;
+    // Counted before an op is pushed and after it is taken, so it never drops below zero
+    std::atomic<std::ptrdiff_t> m_queued{0};
+    std::atomic<size_t> m_sleeping{0};
+    bool m_shutdown = false;
+
+    // State of the current run
+    const std::function<void(size_t)>* m_execute = nullptr;
+    std::unique_ptr<std::atomic<size_t>[]> m_pending;
+    std::atomic<size_t> m_remaining{0};
+    std::atomic<bool> m_failed{false};
+    std::exception_ptr m_error;
+};
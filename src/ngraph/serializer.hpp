@@ -48,6 +48,22 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize the op type and attributes of a single node to a json string
+    /// \param node The node to serialize
+    ///
+    /// Node, argument and output tensor names are left out, and so are the values of a
+    /// Constant, which can be read with Constant::get_data_ptr.
+    /// \throws ngraph_error for ops the serializer does not know
+    std::string serialize_attributes(const Node& node);
+
+    /// \brief Recreate a node written by serialize_attributes
+    /// \param attributes The json string returned by serialize_attributes
+    /// \param args The arguments of the new node
+    /// \param constant_data The values of a Constant, in the layout of Constant::get_data_ptr
+    std::shared_ptr<Node> deserialize_node(const std::string& attributes,
+                                           const NodeVector& args,
+                                           const void* constant_data = nullptr);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
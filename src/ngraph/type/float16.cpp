@@ -58,6 +58,7 @@ float16::float16(float value)
     {
         // Goes to 0
         biased_exp = 0;
+        raw_frac = 0;
     }
     else if (biased_exp == 0xFF)
     {
@@ -67,10 +68,11 @@ float16::float16(float value)
     }
     else if (exp < -14)
     {
-        // denorm or 0
+        // denorm: the implicit leading bit moves into the fraction, which counts units
+        // of 2^-24
         biased_exp = 0;
         raw_frac |= 0x00800000;
-        raw_frac = raw_frac >> (exp + 16);
+        raw_frac = raw_frac >> (-exp - 1);
     }
     else if (exp > 15)
     {
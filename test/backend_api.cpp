@@ -14,9 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <thread>
+
 #include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/runtime/cache/cache_backend.hpp"
+#endif
+#include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
@@ -67,3 +75,273 @@ TEST(backend_api, save_load)
         EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {6.f, 8.f, 10.f, 12.f}));
     }
 }
+
+TEST(backend_api, interpreter_arena_reuse)
+{
+    // A chain whose intermediates can share arena memory; repeated calls with new inputs
+    // must not see values left over from the previous call
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::Add>(A, B);
+    auto t1 = make_shared<op::Multiply>(t0, A);
+    auto t2 = make_shared<op::Subtract>(t1, B);
+    auto t3 = make_shared<op::Add>(t2, t0);
+    auto f = make_shared<Function>(NodeVector{t3, t0}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r0 = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r1 = backend->create_tensor(element::f32, shape);
+
+    for (float scale : {1.f, 2.f, 3.f})
+    {
+        vector<float> av{1.f * scale, 2.f * scale, 3.f * scale, 4.f * scale};
+        vector<float> bv{5.f, 6.f, 7.f, 8.f};
+        copy_data(a, av);
+        copy_data(b, bv);
+        handle->call_with_validate({r0, r1}, {a, b});
+
+        vector<float> expected0;
+        vector<float> expected1;
+        for (size_t i = 0; i < av.size(); i++)
+        {
+            float sum = av[i] + bv[i];
+            expected0.push_back(sum * av[i] - bv[i] + sum);
+            expected1.push_back(sum);
+        }
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(r0), expected0));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(r1), expected1));
+    }
+}
+
+TEST(backend_api, interpreter_inter_op_threads)
+{
+    // Several independent branches joined at the end
+    Shape shape{16, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    NodeVector branches;
+    for (size_t i = 0; i < 8; i++)
+    {
+        shared_ptr<Node> branch = make_shared<op::Dot>(A, B);
+        branch = make_shared<op::Tanh>(make_shared<op::Add>(branch, A));
+        branches.push_back(make_shared<op::Multiply>(branch, B));
+    }
+    auto f = make_shared<Function>(make_shared<op::Concat>(branches, 0), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto sequential = backend->compile(f);
+    set_environment("NGRAPH_INTER_OP_THREADS", "4", 1);
+    auto parallel = backend->compile(f);
+    unset_environment("NGRAPH_INTER_OP_THREADS");
+    EXPECT_EQ(dynamic_pointer_cast<runtime::interpreter::INTExecutable>(parallel)
+                  ->get_num_threads(),
+              4);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto expected = backend->create_tensor(element::f32, Shape{128, 16});
+    auto result = backend->create_tensor(element::f32, Shape{128, 16});
+    for (size_t i = 0; i < 4; i++)
+    {
+        vector<float> av(shape_size(shape));
+        vector<float> bv(shape_size(shape));
+        for (size_t j = 0; j < av.size(); j++)
+        {
+            av[j] = static_cast<float>((j * (i + 1)) % 7) / 7.f;
+            bv[j] = static_cast<float>((j + i) % 5) / 5.f;
+        }
+        copy_data(a, av);
+        copy_data(b, bv);
+        sequential->call_with_validate({expected}, {a, b});
+        parallel->call_with_validate({result}, {a, b});
+        // Each op runs exactly as it does sequentially, so results are bit-for-bit identical
+        EXPECT_EQ(read_vector<float>(expected), read_vector<float>(result));
+    }
+}
+
+TEST(backend_api, interpreter_concurrent_calls)
+{
+    // Concurrent calls of one executable each get their own arena
+    Shape shape{8, 8};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::Add>(A, B);
+    auto t1 = make_shared<op::Multiply>(t0, A);
+    auto t2 = make_shared<op::Subtract>(t1, B);
+    auto f = make_shared<Function>(make_shared<op::Add>(t2, t0), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    for (const char* threads : {"1", "2"})
+    {
+        set_environment("NGRAPH_INTER_OP_THREADS", threads, 1);
+        auto handle = backend->compile(f);
+        unset_environment("NGRAPH_INTER_OP_THREADS");
+
+        vector<thread> callers;
+        vector<int> correct(4, 0);
+        for (size_t c = 0; c < correct.size(); c++)
+        {
+            callers.emplace_back([&, c]() {
+                auto a = backend->create_tensor(element::f32, shape);
+                auto b = backend->create_tensor(element::f32, shape);
+                auto r = backend->create_tensor(element::f32, shape);
+                bool ok = true;
+                for (size_t i = 0; i < 200; i++)
+                {
+                    float x = static_cast<float>(c * 1000 + i);
+                    copy_data(a, vector<float>(shape_size(shape), x));
+                    copy_data(b, vector<float>(shape_size(shape), 1.f));
+                    handle->call_with_validate({r}, {a, b});
+                    float expected = (x + 1) * x - 1 + (x + 1);
+                    for (float v : read_vector<float>(r))
+                    {
+                        ok = ok && v == expected;
+                    }
+                }
+                correct[c] = ok;
+            });
+        }
+        for (thread& t : callers)
+        {
+            t.join();
+        }
+        for (size_t c = 0; c < correct.size(); c++)
+        {
+            EXPECT_TRUE(correct[c]) << "caller " << c << " with " << threads << " threads";
+        }
+    }
+}
+
+#ifdef NGRAPH_JSON_ENABLE
+TEST(backend_api, compile_cache)
+{
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    };
+
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_compile_cache_test");
+    file_util::remove_directory(cache_dir);
+
+    set_environment("NGRAPH_COMPILE_CACHE_DIR", cache_dir.c_str(), 1);
+    auto backend = runtime::Backend::create("INTERPRETER");
+    unset_environment("NGRAPH_COMPILE_CACHE_DIR");
+    auto cache = dynamic_pointer_cast<runtime::cache::CacheBackend>(backend);
+    ASSERT_NE(cache, nullptr);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data<float>(a, {1.f, 2.f, 3.f, 4.f});
+    copy_data<float>(b, {5.f, 6.f, 7.f, 8.f});
+
+    // A structurally identical function hits the cache, even from another backend instance
+    auto first = backend->compile(make_function());
+    auto other_backend = make_shared<runtime::cache::CacheBackend>(
+        runtime::Backend::create("INTERPRETER"), "INTERPRETER", cache_dir);
+    auto second = other_backend->compile(make_function());
+    EXPECT_EQ(cache->get_miss_count(), 1);
+    EXPECT_EQ(cache->get_store_count(), 1);
+    EXPECT_EQ(other_backend->get_hit_count(), 1);
+    EXPECT_EQ(other_backend->get_miss_count(), 0);
+
+    second->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), {6.f, 8.f, 10.f, 12.f}));
+
+    // Within one wrapper the compiled executable itself is reused
+    auto third = backend->compile(make_function());
+    EXPECT_EQ(third, first);
+    EXPECT_EQ(cache->get_hit_count(), 1);
+
+    // Different compile options are cached separately
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("SomeAttribute", true);
+    backend->compile(make_function(), pass_config);
+    EXPECT_EQ(cache->get_miss_count(), 2);
+    EXPECT_EQ(cache->get_hit_count(), 1);
+
+    // The key follows the graph: friendly names do not matter, attributes and edges do
+    pass::PassConfig default_config;
+    auto key_of = [&](shared_ptr<Function> f) {
+        return cache->get_cache_file(f, default_config, false);
+    };
+    auto named = make_function();
+    for (auto node : named->get_ops())
+    {
+        node->set_friendly_name("renamed_" + node->get_name());
+    }
+    EXPECT_EQ(key_of(named), key_of(make_function()));
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto swapped = make_shared<Function>(make_shared<op::Add>(B, A), ParameterVector{A, B});
+    EXPECT_NE(key_of(swapped), key_of(make_function()));
+    auto constant = [&](float value) {
+        auto C = make_shared<op::Parameter>(element::f32, shape);
+        auto k = op::Constant::create(element::f32, shape, {value, value, value, value});
+        return make_shared<Function>(make_shared<op::Add>(C, k), ParameterVector{C});
+    };
+    EXPECT_EQ(key_of(constant(1.f)), key_of(constant(1.f)));
+    EXPECT_NE(key_of(constant(1.f)), key_of(constant(2.f)));
+
+    file_util::remove_directory(cache_dir);
+}
+
+// Forwards to INTERPRETER without declaring Property::executable_save_load
+class NoSaveLoadBackend : public runtime::Backend
+{
+public:
+    shared_ptr<runtime::Tensor> create_tensor(const element::Type& type,
+                                              const Shape& shape) override
+    {
+        return m_backend->create_tensor(type, shape);
+    }
+    shared_ptr<runtime::Tensor> create_tensor(const element::Type& type,
+                                              const Shape& shape,
+                                              void* memory_pointer) override
+    {
+        return m_backend->create_tensor(type, shape, memory_pointer);
+    }
+    shared_ptr<runtime::Executable> compile(shared_ptr<Function> function,
+                                            bool enable_performance_data) override
+    {
+        return m_backend->compile(function, enable_performance_data);
+    }
+
+private:
+    shared_ptr<runtime::Backend> m_backend = runtime::Backend::create("INTERPRETER");
+};
+
+TEST(backend_api, compile_cache_without_save_load)
+{
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    };
+
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_compile_cache_no_save_test");
+    file_util::remove_directory(cache_dir);
+
+    // The cache directory is left alone and compiles are only cached in memory
+    runtime::cache::CacheBackend cache(make_shared<NoSaveLoadBackend>(), "NOSAVE", cache_dir);
+    EXPECT_FALSE(cache.is_disk_cache_enabled());
+    auto first = cache.compile(make_function());
+    auto second = cache.compile(make_function());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(cache.get_miss_count(), 1);
+    EXPECT_EQ(cache.get_hit_count(), 1);
+    EXPECT_EQ(cache.get_store_count(), 0);
+    EXPECT_EQ(cache.get_store_failure_count(), 0);
+    EXPECT_FALSE(file_util::exists(cache_dir));
+}
+#endif
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <future>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
@@ -162,3 +164,38 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result1 = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result2 = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    // Future variant
+    future<bool> done = handle->call_async({result1}, {a, b});
+
+    // Callback variant, in flight at the same time as the first call
+    promise<bool> callback_done;
+    handle->call_async({result2}, {a, b}, [&callback_done](bool rc, exception_ptr error) {
+        callback_done.set_value(rc && error == nullptr);
+    });
+
+    EXPECT_TRUE(done.get());
+    EXPECT_TRUE(callback_done.get_future().get());
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{6, 8, 10, 12}, read_vector<float>(result1), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{6, 8, 10, 12}, read_vector<float>(result2), MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -18,12 +18,36 @@
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
 using namespace std;
 
+// Evaluator for the generic constant folding step that runs on the INTERPRETER backend
+static vector<shared_ptr<op::Constant>> evaluate_on_interpreter(const shared_ptr<Function>& f)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (auto& result : f->get_results())
+    {
+        outputs.push_back(
+            backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    backend->compile(f)->call(outputs, {});
+
+    vector<shared_ptr<op::Constant>> constants;
+    for (auto& output : outputs)
+    {
+        vector<char> data(output->get_size_in_bytes());
+        output->read(data.data(), 0, data.size());
+        constants.push_back(make_shared<op::Constant>(
+            output->get_element_type(), output->get_shape(), data.data()));
+    }
+    return constants;
+}
+
 TEST(constant_folding, constant_reshape)
 {
     Shape shape_in{2, 4};
@@ -364,3 +388,73 @@ TEST(constant_folding, pass_property)
     ASSERT_EQ(false, pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_EQ(false, pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(constant_folding, generic_dot_concat)
+{
+    auto A = make_shared<op::Constant>(element::f32, Shape{2, 2}, vector<float>{1, 2, 3, 4});
+    auto B = make_shared<op::Constant>(element::f32, Shape{2, 1}, vector<float>{1, 0});
+    auto C = make_shared<op::Constant>(element::f32, Shape{2, 1}, vector<float>{0, 1});
+    auto concat = make_shared<op::Concat>(NodeVector{B, C}, 1);
+    auto dot = make_shared<op::Dot>(A, concat);
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto f = make_shared<Function>(make_shared<op::Add>(P, dot), ParameterVector{P});
+
+    // The generic step is off by default
+    pass::ConstantFolding().run_on_function(f);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 1);
+
+    pass::ConstantFolding constant_folding(BuildNodeExecutorMap(), true, evaluate_on_interpreter);
+    constant_folding.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    EXPECT_EQ(constant_folding.get_folded_op_count(), 2);
+    EXPECT_EQ(constant_folding.get_folded_bytes(), 4 * sizeof(float));
+
+    auto add = f->get_results().at(0)->get_argument(0);
+    auto new_const = std::dynamic_pointer_cast<op::Constant>(add->get_argument(1));
+    ASSERT_TRUE(new_const);
+    vector<float> values_expected{1, 2, 3, 4};
+    ASSERT_TRUE(test::all_close_f(
+        values_expected, new_const->get_vector<float>(), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+TEST(constant_folding, generic_size_cap)
+{
+    auto A = make_shared<op::Constant>(element::i32, Shape{4}, vector<int32_t>{1, 2, 3, 4});
+    auto B = make_shared<op::Constant>(element::i32, Shape{4}, vector<int32_t>{5, 6, 7, 8});
+    auto concat = make_shared<op::Concat>(NodeVector{A, B}, 0);
+    auto sum = make_shared<op::Sum>(concat, AxisSet{0});
+    auto f = make_shared<Function>(NodeVector{concat, sum}, ParameterVector{});
+
+    pass::ConstantFolding small_cap(
+        BuildNodeExecutorMap(), true, evaluate_on_interpreter, 4 * sizeof(int32_t));
+    small_cap.run_on_function(f);
+
+    // The 8-element Concat exceeds the cap, so it and the Sum reading it stay in the graph
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(f), 1);
+    EXPECT_EQ(small_cap.get_folded_op_count(), 0);
+
+    pass::ConstantFolding constant_folding(
+        BuildNodeExecutorMap(), true, evaluate_on_interpreter, 8 * sizeof(int32_t));
+    constant_folding.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(f), 0);
+    auto new_const =
+        std::dynamic_pointer_cast<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    EXPECT_EQ(new_const->get_vector<int32_t>(), vector<int32_t>{36});
+    EXPECT_EQ(constant_folding.get_folded_op_count(), 2);
+    EXPECT_EQ(constant_folding.get_folded_bytes(), 9 * sizeof(int32_t));
+}
+
+TEST(constant_folding, generic_needs_evaluator)
+{
+    EXPECT_THROW(pass::ConstantFolding(BuildNodeExecutorMap(), true), CheckFailure);
+    EXPECT_THROW(pass::ConstantFolding({pass::ConstantFolding::CFTransformations::GENERIC}),
+                 CheckFailure);
+}
@@ -0,0 +1,200 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Benchmarks of the CPU backend call path. These live in their own executable because they
+// replace the global operator new to count allocations, which must not leak into unit-test.
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/util.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Counts heap allocations made by any thread while s_count_allocations is set, so that
+// benchmarks can check that a call path does not allocate.
+static atomic<bool> s_count_allocations{false};
+static atomic<size_t> s_allocation_count{0};
+
+void* operator new(size_t size)
+{
+    if (s_count_allocations)
+    {
+        s_allocation_count++;
+    }
+    if (void* p = malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+//
+// Benchmarks steady-state calls of a small graph on the CPU backend through a bound call, and
+// checks that they do not allocate.
+//
+TEST(cpu_call_benchmark, bound_call_no_allocations)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(make_shared<op::Add>(A, B), C),
+                                   ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+
+    const int n_runs = 100000;
+    stopwatch sw;
+
+    sw.start();
+    for (int i = 0; i < n_runs; i++)
+    {
+        handle->call({result}, {a, b, c});
+    }
+    sw.stop();
+    std::cout << "call: " << n_runs << " calls in " << sw.get_milliseconds() << "ms ("
+              << sw.get_nanoseconds() / n_runs << " ns/call)" << std::endl;
+
+    auto bound = handle->bind({result}, {a, b, c});
+    // Warm up, the first call on a runtime context initializes it
+    bound->call();
+
+    sw.start();
+    s_allocation_count = 0;
+    s_count_allocations = true;
+    for (int i = 0; i < n_runs; i++)
+    {
+        bound->call();
+    }
+    s_count_allocations = false;
+    sw.stop();
+    std::cout << "bound call: " << n_runs << " calls in " << sw.get_milliseconds() << "ms ("
+              << sw.get_nanoseconds() / n_runs << " ns/call), " << s_allocation_count
+              << " allocations" << std::endl;
+
+    EXPECT_EQ(s_allocation_count, 0);
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{54, 80, 110, 144}));
+}
+
+//
+// Benchmarks runtime context hand-off on the CPU backend with 1 to 64 client threads sharing
+// one executable, with and without context affinity.
+//
+TEST(cpu_call_benchmark, context_pool_contention)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    size_t num_ctx = max<size_t>(1, std::thread::hardware_concurrency());
+    set_environment("NGRAPH_CPU_CONCURRENCY", to_string(num_ctx).c_str(), 1);
+    for (bool affinity : {false, true})
+    {
+        if (affinity)
+        {
+            set_environment("NGRAPH_CPU_CONTEXT_AFFINITY", "1", 1);
+        }
+        auto backend = runtime::Backend::create("CPU");
+        auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+
+        for (size_t num_threads : {1, 2, 4, 8, 16, 32, 64})
+        {
+            const size_t n_runs = 200000 / num_threads;
+            vector<shared_ptr<runtime::cpu::CPU_BoundCall>> bound_calls;
+            vector<shared_ptr<runtime::Tensor>> results;
+            for (size_t t = 0; t < num_threads; t++)
+            {
+                auto a = backend->create_tensor(element::f32, shape);
+                auto b = backend->create_tensor(element::f32, shape);
+                auto result = backend->create_tensor(element::f32, shape);
+                copy_data(a, vector<float>{1, 2, 3, 4});
+                copy_data(b, vector<float>(4, static_cast<float>(t)));
+                bound_calls.push_back(handle->bind({result}, {a, b}));
+                results.push_back(result);
+            }
+
+            stopwatch sw;
+            sw.start();
+            vector<thread> threads;
+            for (size_t t = 0; t < num_threads; t++)
+            {
+                threads.emplace_back([&bound_calls, t, n_runs]() {
+                    for (size_t i = 0; i < n_runs; i++)
+                    {
+                        bound_calls[t]->call();
+                    }
+                });
+            }
+            for (thread& t : threads)
+            {
+                t.join();
+            }
+            sw.stop();
+            std::cout << "contexts: " << num_ctx << ", affinity: " << affinity
+                      << ", client threads: " << num_threads << ", "
+                      << n_runs * num_threads << " calls in " << sw.get_milliseconds() << "ms ("
+                      << sw.get_nanoseconds() / (n_runs * num_threads) << " ns/call)"
+                      << std::endl;
+
+            for (size_t t = 0; t < num_threads; t++)
+            {
+                float v = static_cast<float>(t);
+                EXPECT_TRUE(test::all_close_f(read_vector<float>(results[t]),
+                                              vector<float>{1 + v, 2 + v, 3 + v, 4 + v}));
+            }
+        }
+    }
+    unset_environment("NGRAPH_CPU_CONTEXT_AFFINITY");
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -66,6 +66,7 @@
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+#include "ngraph/runtime/cpu/op/log_softmax.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
@@ -2359,6 +2360,48 @@ TEST(cpu_fusion, loop_kernel_fusion_one_group)
     }
 }
 
+TEST(cpu_fusion, loop_kernel_fusion_broadcast)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{8, 300};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{300});
+        auto scale = make_shared<op::Parameter>(element::f32, Shape{8});
+        auto six = op::Constant::create<float>(element::f32, Shape{}, std::vector<float>{6.0f});
+        auto biased = a + make_shared<op::Broadcast>(bias, shape, AxisSet{0});
+        auto clip = make_shared<op::Broadcast>(six, shape, AxisSet{0, 1});
+        auto relu6 = make_shared<op::Minimum>(make_shared<op::Relu>(biased), clip);
+        auto scaled = relu6 * make_shared<op::Broadcast>(scale, shape, AxisSet{1});
+        auto out = make_shared<op::Tanh>(scaled) + make_shared<op::Sigmoid>(a);
+        return std::make_shared<Function>(ngraph::NodeVector{out, relu6},
+                                          ParameterVector{a, bias, scale});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<vector<float>> args;
+
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Broadcast>(cpu_f), 0);
+
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 #endif
 
 void sigmoid_multiply_fusion_forward_compute(runtime::Backend* backend,
@@ -2848,6 +2891,47 @@ TEST(cpu_fusion, fuse_leaky_relu)
     EXPECT_TRUE(test::all_close(cpu2_results.at(0), expected_result));
 }
 
+TEST(cpu_fusion, fuse_log_softmax)
+{
+    auto make_function = [](const AxisSet& axes, bool shared_softmax) {
+        auto input = std::make_shared<op::Parameter>(element::f32, Shape{3, 4, 5});
+        auto softmax = std::make_shared<op::Softmax>(input, axes);
+        auto log = std::make_shared<op::Log>(softmax);
+        NodeVector outputs{log};
+        if (shared_softmax)
+        {
+            outputs.push_back(softmax);
+        }
+        return make_shared<Function>(outputs, ParameterVector{input});
+    };
+
+    auto no_fuse1 = make_function(AxisSet{0, 2}, false);
+    auto no_fuse2 = make_function(AxisSet{1}, true);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(no_fuse1);
+    pass_manager.run_passes(no_fuse2);
+    EXPECT_EQ(0, count_ops_of_type<op::CPULogSoftmax>(no_fuse1));
+    EXPECT_EQ(0, count_ops_of_type<op::CPULogSoftmax>(no_fuse2));
+
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<vector<float>> args;
+    vector<float> tensor_val(3 * 4 * 5);
+    rng.initialize(tensor_val);
+    args.push_back(tensor_val);
+
+    for (auto axes : {AxisSet{0}, AxisSet{1}, AxisSet{2}, AxisSet{1, 2}})
+    {
+        auto int_f = make_function(axes, false);
+        auto cpu_f = make_function(axes, false);
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        EXPECT_EQ(1, count_ops_of_type<op::CPULogSoftmax>(cpu_f));
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-5f, 1.0e-5f));
+    }
+}
+
 TEST(cpu_fusion, fuse_update_slice)
 {
     auto make_function = [](bool fuse = true) {
@@ -15,10 +15,14 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <future>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <memory>
+#include <sstream>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -29,15 +33,20 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/erf.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/scatter_add.hpp"
+#include "ngraph/op/scatter_nd_add.hpp"
+#include "ngraph/op/topk.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
@@ -1049,6 +1058,357 @@ TEST(cpu_test, thread_safe_calls_convolution_2d_2items)
     unset_environment("NGRAPH_CPU_CONCURRENCY");
 }
 
+TEST(cpu_test, call_async_in_flight)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A * B + A, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+
+    // Keep more requests in flight than there are runtime contexts, all from this thread
+    const size_t num_requests = 5;
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < num_requests; i++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), static_cast<float>(i)));
+        copy_data(b, vector<float>{1, 2, 3, 4, 5, 6});
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(handle->call_async({results.back()}, {a, b}));
+    }
+
+    for (size_t i = 0; i < num_requests; i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        vector<float> expected;
+        for (float v : {1, 2, 3, 4, 5, 6})
+        {
+            expected.push_back(i * v + i);
+        }
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(results[i])));
+    }
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, memory_reuse_cacheable_multiple_contexts)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    auto shape_a = Shape{2, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a, true);
+    auto B = make_shared<op::Parameter>(element::f32, shape_a, true);
+    auto C = make_shared<op::Parameter>(element::f32, shape_a);
+    auto add = make_shared<op::Add>(A, B);
+    auto relu = make_shared<op::Relu>(add);
+    auto subtract = make_shared<op::Subtract>(C, relu);
+    auto f = make_shared<Function>(subtract, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    ASSERT_NE(handle, nullptr);
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    auto b = backend->create_tensor(element::f32, shape_a);
+    auto c = backend->create_tensor(element::f32, shape_a);
+    copy_data(b, vector<float>{1, 2, 3, 4, 0.5, 1, 8, -8, 17, -0.5});
+    copy_data(c, vector<float>{2, 10, 0, 21, 0, 2, 16, 0, 34, 0});
+
+    // Keeps both contexts busy, so that a context may be handed cached results computed
+    // from input values it has not seen.
+    auto run_concurrently = [&](const vector<float>& expected) {
+        vector<shared_ptr<runtime::Tensor>> results;
+        vector<future<bool>> futures;
+        for (size_t i = 0; i < 4; i++)
+        {
+            results.push_back(backend->create_tensor(element::f32, shape_a));
+            futures.push_back(handle->call_async({results.back()}, {a, b, c}));
+        }
+        for (size_t i = 0; i < futures.size(); i++)
+        {
+            EXPECT_TRUE(futures[i].get());
+            EXPECT_TRUE(test::all_close_f(read_vector<float>(results[i]), expected));
+        }
+    };
+
+    copy_data(a, vector<float>{1, 8, -8, 17, -0.5, 1, 8, -8, 17, -0.5});
+    run_concurrently(vector<float>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+
+    // A single stale call updates one context only
+    copy_data(a, vector<float>{0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+    auto result = backend->create_tensor(element::f32, shape_a);
+    handle->call_with_validate({result}, {a, b, c});
+    vector<float> expected{1, 8, 0, 17, 0, 1, 8, 0, 17, 0};
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+
+    a->set_stale(false);
+    b->set_stale(false);
+    run_concurrently(expected);
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, bound_call)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(make_shared<op::Add>(A, B), C),
+                                   ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+
+    auto bound = handle->bind({result}, {a, b, c});
+    bound->call();
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{54, 80, 110, 144}));
+
+    // Bound tensors are read on every call, not captured at bind time
+    for (size_t i = 0; i < 10; i++)
+    {
+        float v = static_cast<float>(i);
+        copy_data(a, vector<float>(4, v));
+        bound->call();
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
+                                      vector<float>{(v + 5) * 9,
+                                                    (v + 6) * 10,
+                                                    (v + 7) * 11,
+                                                    (v + 8) * 12}));
+    }
+}
+
+TEST(cpu_test, bound_call_multiple_threads)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+
+    const size_t num_threads = 4;
+    vector<shared_ptr<runtime::cpu::CPU_BoundCall>> bound_calls;
+    vector<shared_ptr<runtime::Tensor>> results;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>(4, static_cast<float>(t)));
+        bound_calls.push_back(handle->bind({result}, {a, b}));
+        results.push_back(result);
+    }
+
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&bound_calls, t]() {
+            for (size_t i = 0; i < 100; i++)
+            {
+                bound_calls[t]->call();
+            }
+        });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        float v = static_cast<float>(t);
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(results[t]),
+                                      vector<float>{1 + v, 2 + v, 3 + v, 4 + v}));
+    }
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+TEST(cpu_test, save_load)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+
+    auto handle = backend->compile(f);
+    stringstream ss;
+    handle->save(ss);
+
+    // Loading reuses the compiled graph and memory plan instead of running the passes again
+    size_t run_count = pass::Manager::get_run_count();
+    auto loaded = backend->load(ss);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ(pass::Manager::get_run_count(), run_count);
+    EXPECT_EQ(loaded->get_parameters().size(), 3);
+    EXPECT_EQ(loaded->get_results().size(), 1);
+    loaded->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{54, 80, 110, 144}));
+
+    // A loaded executable can be saved again
+    stringstream resaved;
+    loaded->save(resaved);
+    EXPECT_NE(backend->load(resaved), nullptr);
+}
+
+TEST(cpu_test, save_load_mkldnn)
+{
+    Shape shape_a{1, 2, 4, 4};
+    Shape shape_b{2, 2, 1, 1};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto conv = make_shared<op::Convolution>(A, B);
+    auto f = make_shared<Function>(make_shared<op::Relu>(conv), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(a, vector<float>{1, -2, 3, -4, 5, -6, 7, -8, 1, 2, 3, 4, 5, 6, 7, 8,
+                               0, 1, 0, 1, 1, 0, 1, 0, 2, 2, 2, 2, 3, 3, 3, 3});
+    copy_data(b, vector<float>{1, 2, -1, 1});
+    auto expected = backend->create_tensor(element::f32, conv->get_shape());
+    auto result = backend->create_tensor(element::f32, conv->get_shape());
+
+    // Convolution and Relu are fused into a ConvolutionRelu with MKLDNN layouts
+    auto handle = backend->compile(f);
+    handle->call_with_validate({expected}, {a, b});
+    stringstream ss;
+    handle->save(ss);
+
+    size_t run_count = pass::Manager::get_run_count();
+    auto loaded = backend->load(ss);
+    EXPECT_EQ(pass::Manager::get_run_count(), run_count);
+    loaded->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), read_vector<float>(expected));
+}
+
+TEST(cpu_test, tiered_compilation)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, ParameterVector{A, B, C});
+    auto ops = f->get_ordered_ops();
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("TieredCompilation", true);
+
+    // Executables destroyed before their FULL tier is ready do not wait for it: destroying
+    // them only cancels their compiles, which takes less time than compiling the FAST tier
+    vector<shared_ptr<runtime::Executable>> early;
+    size_t min_fast_compile_us = numeric_limits<size_t>::max();
+    for (size_t i = 0; i < 8; i++)
+    {
+        early.push_back(backend->compile(clone_function(*f), pass_config));
+        backend->remove_compiled_function(early.back());
+        auto stats = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(early.back())
+                         ->get_tier_statistics(runtime::cpu::CompilationTier::FAST);
+        min_fast_compile_us = min(min_fast_compile_us, stats.m_compile_microseconds);
+    }
+    stopwatch destroy_timer;
+    destroy_timer.start();
+    early.clear();
+    destroy_timer.stop();
+    EXPECT_LT(destroy_timer.get_microseconds(), min_fast_compile_us);
+
+    auto handle = backend->compile(f, pass_config);
+    auto cpu_handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    ASSERT_NE(cpu_handle, nullptr);
+
+    // Callable as soon as compile() returns, whichever tier is active
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{54, 80, 110, 144}));
+
+    cpu_handle->wait_for_full_tier();
+    EXPECT_EQ(cpu_handle->get_compilation_tier(), runtime::cpu::CompilationTier::FULL);
+    // Both tiers compiled clones, so the caller's graph is unchanged
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{54, 80, 110, 144}));
+
+    auto fast = cpu_handle->get_tier_statistics(runtime::cpu::CompilationTier::FAST);
+    auto full = cpu_handle->get_tier_statistics(runtime::cpu::CompilationTier::FULL);
+    EXPECT_GT(fast.m_compile_microseconds + full.m_compile_microseconds, 0);
+    EXPECT_EQ(fast.m_call_count + full.m_call_count, 2);
+    EXPECT_GE(full.m_call_count, 1);
+}
+
+TEST(cpu_test, constant_folding_generic)
+{
+    // The CF dispatcher has no kernels for Dot and Concat; the generic step folds them
+    auto A = op::Constant::create(element::f32, Shape{2, 1}, {1, 2});
+    auto B = op::Constant::create(element::f32, Shape{1, 2}, {3, 4});
+    auto C = op::Constant::create(element::f32, Shape{2, 2}, {1, 1, 1, 1});
+    auto dot = make_shared<op::Dot>(A, B);
+    auto concat = make_shared<op::Concat>(NodeVector{dot, C}, 0);
+    auto X = make_shared<op::Parameter>(element::f32, Shape{4, 2});
+    auto f = make_shared<Function>(make_shared<op::Add>(X, concat), ParameterVector{X});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Concat>(f), 0);
+
+    auto x = backend->create_tensor(element::f32, Shape{4, 2});
+    auto result = backend->create_tensor(element::f32, Shape{4, 2});
+    copy_data(x, vector<float>{1, 1, 1, 1, 1, 1, 1, 1});
+    handle->call_with_validate({result}, {x});
+    EXPECT_TRUE(
+        test::all_close_f(read_vector<float>(result), vector<float>{4, 5, 7, 9, 2, 2, 2, 2}));
+}
+
 TEST(cpu_test, constant_reshape)
 {
     Shape shape_in{2, 4};
@@ -1349,6 +1709,169 @@ TEST(cpu_test, gauss_error_function_erf_int32)
     ASSERT_EQ(result_values, expected_values);
 }
 
+TEST(cpu_test, topk_parallel_partial_sort)
+{
+    Shape shape{3, 40, 5};
+    // Small integer values so that every slice contains ties
+    vector<float> input(shape_size(shape));
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = static_cast<float>((i * 7919) % 13);
+    }
+
+    for (size_t axis = 0; axis < shape.size(); axis++)
+    {
+        for (size_t k : {size_t(1), size_t(2), shape[axis]})
+        {
+            for (bool compute_max : {true, false})
+            {
+                vector<vector<int32_t>> indices;
+                vector<vector<float>> values;
+                for (string backend_name : {"INTERPRETER", "CPU"})
+                {
+                    auto A = make_shared<op::Parameter>(element::f32, shape);
+                    auto topk = make_shared<op::TopK>(A, axis, element::i32, k, compute_max);
+                    auto out_indices = make_shared<op::GetOutputElement>(topk, 0);
+                    auto out_values = make_shared<op::GetOutputElement>(topk, 1);
+                    auto f = make_shared<Function>(NodeVector{out_indices, out_values},
+                                                   ParameterVector{A});
+
+                    auto backend = runtime::Backend::create(backend_name);
+                    auto a = backend->create_tensor(element::f32, shape);
+                    copy_data(a, input);
+                    auto result_indices =
+                        backend->create_tensor(element::i32, out_indices->get_shape());
+                    auto result_values =
+                        backend->create_tensor(element::f32, out_values->get_shape());
+
+                    auto handle = backend->compile(f);
+                    handle->call_with_validate({result_indices, result_values}, {a});
+                    indices.push_back(read_vector<int32_t>(result_indices));
+                    values.push_back(read_vector<float>(result_values));
+                }
+                EXPECT_EQ(indices.at(0), indices.at(1)) << "axis " << axis << " k " << k;
+                EXPECT_EQ(values.at(0), values.at(1)) << "axis " << axis << " k " << k;
+            }
+        }
+    }
+}
+
+TEST(cpu_test, embedding_lookup_int8_table)
+{
+    Shape indices_shape{5};
+    Shape weights_shape{4, 3};
+    auto I = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto W = make_shared<op::Parameter>(element::i8, weights_shape);
+    auto embed = make_shared<op::EmbeddingLookup>(I, W);
+    auto f = make_shared<Function>(embed, ParameterVector{I, W});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto indices = backend->create_tensor(element::i32, indices_shape);
+    copy_data(indices, vector<int32_t>{3, 0, 2, 2, 1});
+    auto weights = backend->create_tensor(element::i8, weights_shape);
+    copy_data(weights, vector<int8_t>{1, 2, 3, -4, -5, -6, 7, 8, 9, -10, -11, -12});
+    auto result = backend->create_tensor(element::i8, Shape{5, 3});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {indices, weights});
+    EXPECT_EQ((vector<int8_t>{-10, -11, -12, 1, 2, 3, 7, 8, 9, 7, 8, 9, -4, -5, -6}),
+              read_vector<int8_t>(result));
+
+    // Indices are bounds-checked before any row is copied
+    copy_data(indices, vector<int32_t>{3, 0, 4, 2, 1});
+    EXPECT_THROW(handle->call_with_validate({result}, {indices, weights}), ngraph_error);
+}
+
+TEST(cpu_test, scatter_add_duplicate_indices)
+{
+    // Row 1 receives enough duplicate updates to be summed in parallel chunks
+    Shape inputs_shape{4, 3};
+    Shape indices_shape{300};
+    Shape updates_shape{300, 3};
+    vector<int32_t> indices(shape_size(indices_shape));
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = (i % 5 == 0) ? static_cast<int32_t>(i % 4) : 1;
+    }
+    vector<float> inputs(shape_size(inputs_shape));
+    vector<float> updates(shape_size(updates_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(inputs);
+    rng.initialize(updates);
+
+    auto run = [&](const string& backend_name) {
+        auto I = make_shared<op::Parameter>(element::f32, inputs_shape);
+        auto X = make_shared<op::Parameter>(element::i32, indices_shape);
+        auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+        auto f = make_shared<Function>(make_shared<op::ScatterAdd>(I, X, U),
+                                       ParameterVector{I, X, U});
+
+        auto backend = runtime::Backend::create(backend_name);
+        auto a = backend->create_tensor(element::f32, inputs_shape);
+        copy_data(a, inputs);
+        auto b = backend->create_tensor(element::i32, indices_shape);
+        copy_data(b, indices);
+        auto c = backend->create_tensor(element::f32, updates_shape);
+        copy_data(c, updates);
+        auto result = backend->create_tensor(element::f32, inputs_shape);
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b, c});
+        return read_vector<float>(result);
+    };
+
+    auto expected = run("INTERPRETER");
+    EXPECT_TRUE(test::all_close(expected, run("CPU"), 1e-5f, 1e-5f));
+
+    // Deterministic mode sums each row in index order, like the reference
+    set_environment("NGRAPH_CPU_DETERMINISTIC_SCATTER", "1", 1);
+    EXPECT_EQ(expected, run("CPU"));
+    unset_environment("NGRAPH_CPU_DETERMINISTIC_SCATTER");
+}
+
+TEST(cpu_test, scatter_nd_add_deterministic)
+{
+    // Every update but one lands on row 2, so the parallel kernel would split the sum
+    Shape inputs_shape{4, 5};
+    Shape indices_shape{257, 1};
+    Shape updates_shape{257, 5};
+    vector<int64_t> indices(shape_size(indices_shape), 2);
+    indices[100] = 0;
+    vector<float> inputs(shape_size(inputs_shape));
+    vector<float> updates(shape_size(updates_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(inputs);
+    rng.initialize(updates);
+
+    auto run = [&](const string& backend_name) {
+        auto I = make_shared<op::Parameter>(element::f32, inputs_shape);
+        auto X = make_shared<op::Parameter>(element::i64, indices_shape);
+        auto U = make_shared<op::Parameter>(element::f32, updates_shape);
+        auto f = make_shared<Function>(make_shared<op::ScatterNDAdd>(I, X, U),
+                                       ParameterVector{I, X, U});
+
+        auto backend = runtime::Backend::create(backend_name);
+        auto a = backend->create_tensor(element::f32, inputs_shape);
+        copy_data(a, inputs);
+        auto b = backend->create_tensor(element::i64, indices_shape);
+        copy_data(b, indices);
+        auto c = backend->create_tensor(element::f32, updates_shape);
+        copy_data(c, updates);
+        auto result = backend->create_tensor(element::f32, inputs_shape);
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b, c});
+        return read_vector<float>(result);
+    };
+
+    // Sums each row in index order, like the reference, on every call
+    set_environment("NGRAPH_CPU_DETERMINISTIC_SCATTER", "1", 1);
+    auto expected = run("INTERPRETER");
+    EXPECT_EQ(expected, run("CPU"));
+    EXPECT_EQ(expected, run("CPU"));
+    unset_environment("NGRAPH_CPU_DETERMINISTIC_SCATTER");
+}
+
 TEST(cpu_test, max_pool_with_indices_2d_2channel_2image)
 {
     Shape shape_a{2, 2, 5, 5};
@@ -1729,3 +2252,96 @@ TEST(cpu_test, avg_pool_bprop_2d_2channel_2image)
         read_vector<float>(result),
         MIN_FLOAT_TOLERANCE_BITS));
 }
+
+// Runs Softmax and Log(Softmax) over axis 1 of `shape` on the CPU backend and compares them with
+// a double precision reference. The first 16 positions of every reduction, a full lane group of
+// the native kernel, and every 7th position after that are masked with -inf.
+template <typename T>
+static void check_masked_softmax(const element::Type& type, const Shape& shape, double tolerance)
+{
+    size_t outer = shape[0];
+    size_t n = shape[1];
+    size_t inner = shape_size(shape) / (outer * n);
+    vector<float> values(shape_size(shape));
+    test::Uniform<float> rng(-4.0f, 4.0f);
+    rng.initialize(values);
+    vector<T> input(values.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        size_t j = (i / inner) % n;
+        input[i] = (j < 16 || j % 7 == 3) ? T(-numeric_limits<float>::infinity()) : T(values[i]);
+    }
+
+    vector<double> expected(input.size());
+    vector<double> expected_log(input.size());
+    for (size_t o = 0; o < outer; o++)
+    {
+        for (size_t c = 0; c < inner; c++)
+        {
+            auto x = [&](size_t j) {
+                return static_cast<double>(static_cast<float>(input[(o * n + j) * inner + c]));
+            };
+            double max = -numeric_limits<double>::infinity();
+            for (size_t j = 0; j < n; j++)
+            {
+                max = std::max(max, x(j));
+            }
+            double sum = 0;
+            for (size_t j = 0; j < n; j++)
+            {
+                sum += std::exp(x(j) - max);
+            }
+            for (size_t j = 0; j < n; j++)
+            {
+                expected[(o * n + j) * inner + c] = std::exp(x(j) - max) / sum;
+                expected_log[(o * n + j) * inner + c] = x(j) - max - std::log(sum);
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    auto run = [&](bool log) {
+        auto A = make_shared<op::Parameter>(type, shape);
+        shared_ptr<Node> softmax = make_shared<op::Softmax>(A, AxisSet{1});
+        if (log)
+        {
+            softmax = make_shared<op::Log>(softmax);
+        }
+        auto f = make_shared<Function>(softmax, ParameterVector{A});
+        auto a = backend->create_tensor(type, shape);
+        copy_data(a, input);
+        auto result = backend->create_tensor(type, shape);
+        backend->compile(f)->call_with_validate({result}, {a});
+        return read_vector<T>(result);
+    };
+
+    auto softmax = run(false);
+    auto log_softmax = run(true);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        EXPECT_NEAR(expected[i], static_cast<float>(softmax[i]), tolerance) << "at " << i;
+        if (std::isinf(expected_log[i]))
+        {
+            EXPECT_EQ(expected_log[i], static_cast<float>(log_softmax[i])) << "at " << i;
+        }
+        else
+        {
+            EXPECT_NEAR(expected_log[i],
+                        static_cast<float>(log_softmax[i]),
+                        tolerance * (1 + std::fabs(expected_log[i])))
+                << "at " << i;
+        }
+    }
+}
+
+TEST(cpu_test, softmax_masked)
+{
+    // inner == 1 splits each row across the lanes, inner > 1 gives each lane its own row.
+    // Both cover full lane groups and a scalar tail.
+    for (const Shape& shape : {Shape{3, 37, 1}, Shape{2, 40, 5}, Shape{2, 33, 17}})
+    {
+        check_masked_softmax<float>(element::f32, shape, 1e-6);
+        check_masked_softmax<float16>(element::f16, shape, 2e-3);
+        check_masked_softmax<bfloat16>(element::bf16, shape, 1.6e-2);
+    }
+}
@@ -23,13 +23,19 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
+#include "ngraph/op/topk.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
@@ -335,9 +341,111 @@ TEST(CSE, one_hot)
     }
 }
 
+TEST(CSE, slice_concat)
+{
+    Shape shape{4, 6};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto slice1 = std::make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 6});
+    auto slice2 = std::make_shared<op::Slice>(A, Coordinate{0, 0}, Coordinate{2, 6});
+    auto slice3 = std::make_shared<op::Slice>(A, Coordinate{2, 0}, Coordinate{4, 6});
+    auto concat1 = std::make_shared<op::Concat>(NodeVector{slice1, slice3}, 0);
+    auto concat2 = std::make_shared<op::Concat>(NodeVector{slice2, slice3}, 0);
+    auto concat3 = std::make_shared<op::Concat>(NodeVector{slice2, slice3}, 1);
+    auto f = std::make_shared<Function>(NodeVector{concat1, concat2, concat3}, ParameterVector{A});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+    ASSERT_EQ(concat3->get_argument(0), concat1->get_argument(0));
+    ASSERT_NE(concat3->get_argument(0), concat3->get_argument(1));
+}
+
+TEST(CSE, subtract_not_commutative)
+{
+    Shape shape{2, 2};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, shape);
+    auto sub1 = std::make_shared<op::Subtract>(A, B);
+    auto sub2 = std::make_shared<op::Subtract>(B, A);
+    auto min1 = std::make_shared<op::Minimum>(A, B);
+    auto min2 = std::make_shared<op::Minimum>(B, A);
+    auto f = std::make_shared<Function>(NodeVector{sub1, sub2, min1, min2}, ParameterVector{A, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_EQ(f->get_results().at(2)->get_argument(0), f->get_results().at(3)->get_argument(0));
+}
+
+TEST(CSE, large_constant)
+{
+    Shape shape{256};
+    std::vector<float> values(shape_size(shape), 1.5f);
+    std::vector<float> other_values(values);
+    other_values.back() = 2.5f;
+    auto c1 = op::Constant::create(element::f32, shape, values);
+    auto c2 = op::Constant::create(element::f32, shape, values);
+    auto c3 = op::Constant::create(element::f32, shape, other_values);
+    auto abs1 = std::make_shared<op::Abs>(c1);
+    auto abs2 = std::make_shared<op::Abs>(c2);
+    auto abs3 = std::make_shared<op::Abs>(c3);
+    auto f = std::make_shared<Function>(NodeVector{abs1, abs2, abs3}, ParameterVector{});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(abs1->get_argument(0), abs3->get_argument(0));
+}
+
 TEST(CSE, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::CommonSubexpressionElimination>();
     ASSERT_EQ(true, pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_EQ(false, pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(CSE, convolution_pool_topk)
+{
+    auto A = std::make_shared<op::Parameter>(element::f32, Shape{1, 2, 6, 6});
+    auto W = std::make_shared<op::Parameter>(element::f32, Shape{2, 2, 3, 3});
+    auto conv1 = std::make_shared<op::Convolution>(A, W, Strides{1, 1});
+    auto conv2 = std::make_shared<op::Convolution>(A, W, Strides{1, 1});
+    auto conv3 = std::make_shared<op::Convolution>(A, W, Strides{2, 2});
+    auto pool1 = std::make_shared<op::MaxPool>(A, Shape{2, 2});
+    auto pool2 = std::make_shared<op::MaxPool>(A, Shape{2, 2});
+    auto pool3 = std::make_shared<op::MaxPool>(A, Shape{3, 3});
+    auto B = std::make_shared<op::Parameter>(element::f32, Shape{8});
+    auto topk1 = std::make_shared<op::TopK>(B, 0, element::i32, 2, true);
+    auto topk2 = std::make_shared<op::TopK>(B, 0, element::i32, 2, true);
+    auto topk3 = std::make_shared<op::TopK>(B, 0, element::i32, 2, false);
+    auto f = std::make_shared<Function>(
+        NodeVector{conv1,
+                   conv2,
+                   conv3,
+                   pool1,
+                   pool2,
+                   pool3,
+                   std::make_shared<op::GetOutputElement>(topk1, 1),
+                   std::make_shared<op::GetOutputElement>(topk2, 1),
+                   std::make_shared<op::GetOutputElement>(topk3, 1)},
+        ParameterVector{A, W, B});
+    pass::Manager pass_manager;
+
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    auto result = [&](size_t i) { return f->get_results().at(i)->get_argument(0); };
+    ASSERT_EQ(result(0), result(1));
+    ASSERT_NE(result(0), result(2));
+    ASSERT_EQ(result(3), result(4));
+    ASSERT_NE(result(3), result(5));
+    ASSERT_EQ(result(6), result(7));
+    ASSERT_NE(result(6), result(8));
+}
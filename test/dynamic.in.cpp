@@ -16,6 +16,8 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/batching_executable.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -159,3 +161,131 @@ NGRAPH_TEST(dynamic_${BACKEND_NAME}, transpose)
         ASSERT_TRUE(test::all_close_f(results, expected_results[i], MIN_FLOAT_TOLERANCE_BITS));
     }
 }
+
+NGRAPH_TEST(dynamic_${BACKEND_NAME}, executable_cache)
+{
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto perm = make_shared<op::Parameter>(element::i32, PartialShape{Dimension::dynamic()});
+    auto perm_i64 = make_shared<op::Convert>(perm, element::i64);
+
+    auto x_transpose = make_shared<op::Transpose>(x, perm_i64);
+
+    auto f = make_shared<Function>(NodeVector{x_transpose}, ParameterVector{x, perm});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+
+    auto ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(backend->compile(f));
+    ASSERT_NE(ex, nullptr);
+    ex->set_cache_capacity(2);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic());
+
+    // The permutation is shape-relevant, so calls differing only in its value must not share a
+    // compiled clone.
+    std::vector<Shape> x_shapes{Shape{2, 3}, Shape{2, 3}, Shape{2, 3}, Shape{2, 2, 3}, Shape{2, 3}};
+    std::vector<std::vector<int32_t>> perms{{0, 1}, {1, 0}, {0, 1}, {2, 1, 0}, {1, 0}};
+    std::vector<std::vector<float>> inputs{{1, 2, 3, 4, 5, 6},
+                                           {1, 2, 3, 4, 5, 6},
+                                           {1, 2, 3, 4, 5, 6},
+                                           {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12},
+                                           {1, 2, 3, 4, 5, 6}};
+    std::vector<Shape> expected_result_shapes{
+        Shape{2, 3}, Shape{3, 2}, Shape{2, 3}, Shape{3, 2, 2}, Shape{3, 2}};
+    std::vector<std::vector<float>> expected_results{{1, 2, 3, 4, 5, 6},
+                                                     {1, 4, 2, 5, 3, 6},
+                                                     {1, 2, 3, 4, 5, 6},
+                                                     {1, 7, 4, 10, 2, 8, 5, 11, 3, 9, 6, 12},
+                                                     {1, 4, 2, 5, 3, 6}};
+    std::vector<size_t> expected_hits{0, 0, 1, 1, 1};
+    std::vector<size_t> expected_misses{1, 2, 2, 3, 4};
+    std::vector<size_t> expected_evictions{0, 0, 0, 1, 2};
+
+    for (size_t i = 0; i < x_shapes.size(); i++)
+    {
+        auto t_x = backend->create_tensor(element::f32, x_shapes[i]);
+        auto t_perm = backend->create_tensor(element::i32, Shape{perms[i].size()});
+
+        copy_data(t_x, inputs[i]);
+        copy_data(t_perm, perms[i]);
+
+        ex->call_with_validate({t_r}, {t_x, t_perm});
+
+        ASSERT_EQ(t_r->get_shape(), expected_result_shapes[i]);
+        ASSERT_TRUE(test::all_close_f(
+            read_vector<float>(t_r), expected_results[i], MIN_FLOAT_TOLERANCE_BITS));
+
+        EXPECT_EQ(ex->get_cache_hit_count(), expected_hits[i]);
+        EXPECT_EQ(ex->get_cache_miss_count(), expected_misses[i]);
+        EXPECT_EQ(ex->get_cache_eviction_count(), expected_evictions[i]);
+        EXPECT_LE(ex->get_cache_size(), 2);
+    }
+
+    ex->clear_cache();
+    EXPECT_EQ(ex->get_cache_size(), 0);
+}
+
+NGRAPH_TEST(dynamic_${BACKEND_NAME}, batching_executable)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(NodeVector{a * b + a}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+
+    // The batch is dispatched as soon as all seven samples are queued, long before the
+    // latency window closes.
+    auto ex = make_shared<runtime::dynamic::BatchingExecutable>(
+        backend, backend->compile(f), 0, 7, std::chrono::seconds(60));
+
+    std::vector<size_t> batch_sizes{1, 1, 2, 1, 1, 1};
+    std::vector<std::shared_ptr<runtime::Tensor>> results;
+    std::vector<std::future<bool>> futures;
+    for (size_t i = 0; i < batch_sizes.size(); i++)
+    {
+        Shape shape{batch_sizes[i], 3};
+        auto t_a = backend->create_tensor(element::f32, shape);
+        auto t_b = backend->create_tensor(element::f32, shape);
+        copy_data(t_a, std::vector<float>(shape_size(shape), static_cast<float>(i)));
+        copy_data(t_b, std::vector<float>(shape_size(shape), 2));
+        // Mix static and dynamic output tensors
+        if (i % 2 == 0)
+        {
+            results.push_back(backend->create_tensor(element::f32, shape));
+        }
+        else
+        {
+            results.push_back(backend->create_dynamic_tensor(
+                element::f32, PartialShape{Dimension::dynamic(), 3}));
+        }
+        futures.push_back(ex->call_async({results.back()}, {t_a, t_b}));
+    }
+
+    for (size_t i = 0; i < batch_sizes.size(); i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        ASSERT_EQ(results[i]->get_shape(), (Shape{batch_sizes[i], 3}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(results[i]),
+                                      std::vector<float>(batch_sizes[i] * 3, 3.0f * i),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+    }
+
+    EXPECT_EQ(ex->get_request_count(), 6);
+    EXPECT_EQ(ex->get_batch_count(), 1);
+    std::vector<size_t> batch_size_histogram = ex->get_batch_size_histogram();
+    ASSERT_EQ(batch_size_histogram.size(), 8);
+    EXPECT_EQ(batch_size_histogram[7], 1);
+    size_t delays = 0;
+    for (size_t count : ex->get_queueing_delay_histogram())
+    {
+        delays += count;
+    }
+    EXPECT_EQ(delays, 6);
+    EXPECT_LE(ex->get_mean_queueing_delay(), ex->get_max_queueing_delay());
+
+    // Inputs that disagree on the batch size are rejected when the call is made
+    auto t_a = backend->create_tensor(element::f32, Shape{1, 3});
+    auto t_r = backend->create_tensor(element::f32, Shape{1, 3});
+    copy_data(t_a, std::vector<float>{1, 2, 3});
+    auto t_bad = backend->create_tensor(element::f32, Shape{2, 4});
+    EXPECT_ANY_THROW(ex->call({t_r}, {t_a, t_bad}));
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <climits>
+#include <cmath>
 #include <random>
 
 #include "gtest/gtest.h"
@@ -65,6 +66,19 @@ TEST(float16, conversions)
     EXPECT_EQ(static_cast<float>(f16), 1.5);
 }
 
+TEST(float16, underflow)
+{
+    // Below the smallest denormal
+    EXPECT_EQ(static_cast<float>(float16(1e-13f)), 0.0f);
+    EXPECT_EQ(static_cast<float>(float16(-1e-8f)), 0.0f);
+    // Denormals
+    EXPECT_EQ(static_cast<float>(float16(std::ldexp(1.0f, -24))), std::ldexp(1.0f, -24));
+    EXPECT_EQ(static_cast<float>(float16(std::ldexp(3.0f, -20))), std::ldexp(3.0f, -20));
+    EXPECT_EQ(static_cast<float>(float16(-std::ldexp(1.0f, -15))), -std::ldexp(1.0f, -15));
+    // Smallest normal
+    EXPECT_EQ(static_cast<float>(float16(std::ldexp(1.0f, -14))), std::ldexp(1.0f, -14));
+}
+
 TEST(float16, assigns)
 {
     float16 f16;
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -23,7 +24,9 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -41,3 +44,217 @@ TEST(pass_manager, add)
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+TEST(pass_manager, ordered_ops_cache)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(neg, ParameterVector{A, B});
+
+    auto sorted = f->get_ordered_ops();
+    EXPECT_EQ(sorted, f->get_ordered_ops());
+    EXPECT_TRUE(validate_list(sorted));
+
+    auto mul = make_shared<op::Multiply>(A, B);
+    f->replace_node(add, mul);
+    sorted = f->get_ordered_ops();
+    EXPECT_TRUE(validate_list(sorted));
+    EXPECT_EQ(find(sorted.begin(), sorted.end(), add), sorted.end());
+    EXPECT_NE(find(sorted.begin(), sorted.end(), mul), sorted.end());
+
+    auto abs = make_shared<op::Abs>(A);
+    neg->add_control_dependency(abs);
+    sorted = f->get_ordered_ops(true);
+    auto abs_it = find(sorted.begin(), sorted.end(), abs);
+    ASSERT_NE(abs_it, sorted.end());
+    EXPECT_LT(abs_it, find(sorted.begin(), sorted.end(), neg));
+    auto sorted_no_cdeps = f->get_ordered_ops(false);
+    EXPECT_EQ(find(sorted_no_cdeps.begin(), sorted_no_cdeps.end(), abs), sorted_no_cdeps.end());
+
+    neg->remove_control_dependency(abs);
+    sorted = f->get_ordered_ops(true);
+    EXPECT_EQ(find(sorted.begin(), sorted.end(), abs), sorted.end());
+
+    // Each function tracks the edits of its own ops
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto g_abs = make_shared<op::Abs>(C);
+    auto g = make_shared<Function>(g_abs, ParameterVector{C});
+    auto f_ops = f->get_ordered_ops_snapshot();
+    auto g_ops = g->get_ordered_ops_snapshot();
+    auto g_neg = make_shared<op::Negative>(C);
+    g->replace_node(g_abs, g_neg);
+    EXPECT_EQ(f->get_ordered_ops_snapshot(), f_ops);
+    EXPECT_EQ(f->get_ordered_ops(), sorted);
+
+    // A recomputed order leaves the snapshots held by callers untouched
+    auto new_g_ops = g->get_ordered_ops_snapshot();
+    EXPECT_NE(new_g_ops, g_ops);
+    EXPECT_NE(find(g_ops->begin(), g_ops->end(), g_abs), g_ops->end());
+    EXPECT_EQ(find(new_g_ops->begin(), new_g_ops->end(), g_abs), new_g_ops->end());
+    EXPECT_NE(find(new_g_ops->begin(), new_g_ops->end(), g_neg), new_g_ops->end());
+}
+
+TEST(pass_manager, set_ordered_ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto abs = make_shared<op::Abs>(A);
+    auto neg = make_shared<op::Negative>(A);
+    auto add = make_shared<op::Add>(abs, neg);
+    auto f = make_shared<Function>(add, ParameterVector{A});
+
+    auto sorted = f->get_ordered_ops();
+    auto result = f->get_results().at(0);
+    // Pick the order of the two independent ops that the sort did not
+    NodeVector schedule{A, abs, neg, add, result};
+    if (sorted == schedule)
+    {
+        schedule = NodeVector{A, neg, abs, add, result};
+    }
+    f->set_ordered_ops(schedule);
+    EXPECT_EQ(f->get_ordered_ops(), schedule);
+
+    // Unrelated edits keep the schedule, edits that break it fall back to sorting
+    auto other = make_shared<op::Negative>(make_shared<op::Parameter>(element::f32, shape));
+    other->add_control_dependency(A);
+    EXPECT_EQ(f->get_ordered_ops(), schedule);
+
+    auto mul = make_shared<op::Multiply>(abs, neg);
+    f->replace_node(add, mul);
+    sorted = f->get_ordered_ops();
+    EXPECT_TRUE(validate_list(sorted));
+    EXPECT_NE(find(sorted.begin(), sorted.end(), mul), sorted.end());
+    EXPECT_EQ(find(sorted.begin(), sorted.end(), add), sorted.end());
+}
+
+namespace
+{
+    // Op holding sub-functions, so that the pass manager sees a module of several functions
+    class FunctionHolder : public op::Op
+    {
+    public:
+        FunctionHolder(const NodeVector& args, const vector<shared_ptr<Function>>& functions)
+            : Op("FunctionHolder", args)
+            , m_functions(functions)
+        {
+            constructor_validate_and_infer_types();
+        }
+
+        void validate_and_infer_types() override
+        {
+            set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+        }
+
+        shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override
+        {
+            return make_shared<FunctionHolder>(new_args, m_functions);
+        }
+
+        vector<shared_ptr<Function>> get_functions() const override { return m_functions; }
+    private:
+        vector<shared_ptr<Function>> m_functions;
+    };
+
+    class RecordFunctions : public pass::FunctionPass
+    {
+    public:
+        RecordFunctions(mutex* records_mutex, vector<string>* records)
+            : m_records_mutex(records_mutex)
+            , m_records(records)
+        {
+            set_property(pass::PassProperty::THREAD_SAFE, true);
+        }
+
+        bool run_on_function(shared_ptr<Function> f) override
+        {
+            lock_guard<mutex> lock(*m_records_mutex);
+            m_records->push_back(f->get_name());
+            return false;
+        }
+
+    private:
+        mutex* m_records_mutex;
+        vector<string>* m_records;
+    };
+}
+
+TEST(pass_manager, parallel_function_passes)
+{
+    Shape shape{2, 2};
+    vector<shared_ptr<Function>> functions;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        functions.push_back(make_shared<Function>((A + B) * A, ParameterVector{A, B}));
+    }
+    auto P = make_shared<op::Parameter>(element::f32, shape);
+    auto holder = make_shared<FunctionHolder>(NodeVector{P}, functions);
+    auto f = make_shared<Function>(holder, ParameterVector{P});
+
+    mutex records_mutex;
+    vector<string> records;
+    pass::Manager pass_manager;
+    pass_manager.set_num_threads(4);
+    pass_manager.register_pass<RecordFunctions>(&records_mutex, &records);
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(f);
+
+    // Every function of the module was visited exactly once
+    vector<string> expected{f->get_name()};
+    for (auto& function : functions)
+    {
+        expected.push_back(function->get_name());
+        auto add = function->get_results().at(0)->get_argument(0)->get_argument(0);
+        EXPECT_EQ(add->liveness_new_list.size(), 1);
+    }
+    sort(expected.begin(), expected.end());
+    sort(records.begin(), records.end());
+    EXPECT_EQ(records, expected);
+}
+
+TEST(pass_manager, cancellation)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(A), ParameterVector{A});
+
+    mutex records_mutex;
+    vector<string> records;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<RecordFunctions>(&records_mutex, &records);
+    pass_manager.register_pass<RecordFunctions>(&records_mutex, &records);
+    // Cancelled once the first pass has run
+    pass_manager.set_cancellation_check([&records]() { return !records.empty(); });
+    EXPECT_THROW(pass_manager.run_passes(f), ngraph_error);
+    EXPECT_EQ(records.size(), 1);
+}
+
+TEST(pass_manager, profile)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto reshape = make_shared<op::Reshape>(A, AxisVector{0, 1}, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(reshape), ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.set_profiling(true);
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.run_passes(f);
+
+    auto& profile = pass_manager.get_profile();
+    ASSERT_EQ(profile.size(), 1);
+    EXPECT_NE(profile[0].m_name.find("ReshapeElimination"), string::npos);
+    // Parameter, Reshape, Abs and Result before; the identity Reshape is gone after
+    EXPECT_EQ(profile[0].m_nodes_before, 4);
+    EXPECT_EQ(profile[0].m_nodes_after, 3);
+    EXPECT_EQ(profile[0].m_matchers_fired, 1);
+    EXPECT_GE(profile[0].m_peak_rss_delta_bytes, 0);
+
+    string json = pass_manager.get_profile_json();
+    EXPECT_NE(json.find("\"nodes_before\": 4"), string::npos);
+    EXPECT_NE(json.find("\"matchers_fired\": 1"), string::npos);
+}
@@ -27,6 +27,7 @@
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/memory_schedule.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "util/test_tools.hpp"
 
@@ -204,6 +205,49 @@ TEST(memory_manager, memory_align)
     EXPECT_EQ(128, mm.allocate(4));
 }
 
+TEST(memory_manager, interval_planner)
+{
+    pass::IntervalMemoryPlanner planner;
+    size_t a = planner.add_buffer(1, 0);
+    size_t b = planner.add_buffer(2, 0);
+    planner.release(a, 0);
+    size_t c = planner.add_buffer(2, 1);
+    planner.release(b, 1);
+    planner.release(c, 1);
+    planner.plan();
+
+    EXPECT_EQ(4, planner.lower_bound());
+    EXPECT_EQ(4, planner.max_allocated());
+    // b and c are live at the same time
+    size_t b_offset = planner.get_offset(b);
+    size_t c_offset = planner.get_offset(c);
+    EXPECT_TRUE(b_offset + 2 <= c_offset || c_offset + 2 <= b_offset);
+
+    // Allocating the same buffers in program order leaves a hole that c does not fit
+    pass::MemoryManager mm;
+    mm.allocate(1);
+    mm.allocate(2);
+    mm.free(0);
+    mm.allocate(2);
+    EXPECT_EQ(5, mm.max_allocated());
+}
+
+TEST(memory_manager, interval_planner_align)
+{
+    pass::IntervalMemoryPlanner planner{64};
+    size_t a = planner.add_buffer(4, 0);
+    size_t b = planner.add_buffer(4, 0);
+    size_t c = planner.add_buffer(4, 1);
+    planner.release(a, 0);
+    planner.plan();
+
+    EXPECT_EQ(128, planner.lower_bound());
+    EXPECT_EQ(128, planner.max_allocated());
+    EXPECT_EQ(0, planner.get_offset(a) % 64);
+    EXPECT_NE(planner.get_offset(b), planner.get_offset(c));
+    EXPECT_NE(planner.get_offset(a), planner.get_offset(b));
+}
+
 TEST(memory_layout, basic)
 {
     string dump_file = "memory_layout.txt";
@@ -219,6 +263,52 @@ TEST(memory_layout, basic)
     EXPECT_EQ(12, temporary_pool_size);
 }
 
+TEST(memory_layout, interval_planning)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, true);
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    EXPECT_LE(graph->get_temporary_pool_size(), 12);
+}
+
+TEST(memory_layout, memory_schedule)
+{
+    // Each branch widens the input and reduces it again, so running the branches one after
+    // the other keeps a single wide tensor live
+    auto make_graph = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+        NodeVector sums;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            auto wide = make_shared<op::Broadcast>(A, Shape{2, 1024}, AxisSet{1});
+            sums.push_back(make_shared<op::Sum>(wide, AxisSet{1}));
+        }
+        auto concat = make_shared<op::Concat>(sums, 0);
+        return make_shared<Function>(concat, ParameterVector{A});
+    };
+
+    auto unscheduled = make_graph();
+    pass::Manager unscheduled_manager;
+    unscheduled_manager.register_pass<pass::Liveness>();
+    unscheduled_manager.register_pass<pass::MemoryLayout>();
+    unscheduled_manager.run_passes(unscheduled);
+
+    auto scheduled = make_graph();
+    pass::Manager scheduled_manager;
+    scheduled_manager.register_pass<pass::MemorySchedule>();
+    scheduled_manager.register_pass<pass::Liveness>();
+    scheduled_manager.register_pass<pass::MemoryLayout>();
+    scheduled_manager.run_passes(scheduled);
+
+    EXPECT_TRUE(validate_list(scheduled->get_ordered_ops()));
+    EXPECT_LE(scheduled->get_temporary_pool_size(), unscheduled->get_temporary_pool_size());
+    // One wide tensor and the sums
+    EXPECT_LE(scheduled->get_temporary_pool_size(), 2 * 1024 * 4 + 4 * 2 * 4 + 8 * 4);
+}
+
 TEST(memory_layout, constant)
 {
     string dump_file = "constant.txt";
@@ -30,10 +30,12 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/sum.hpp"
+#include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -303,6 +305,124 @@ std::ostream& operator<<(std::ostream& os, const ngraph::NodeVector& nv)
     return os;
 }
 
+TEST(pattern, graph_rewrite_dispatch_order)
+{
+    Shape shape{2};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto b = make_shared<op::Parameter>(element::f32, shape);
+    auto mul = make_shared<op::Multiply>(a, b);
+    auto add = make_shared<op::Add>(mul, b);
+    auto f = make_shared<Function>(add, ParameterVector{a, b});
+
+    // Callbacks never rewrite, so every matcher that matches a node is reported in the order
+    // the matchers were added
+    vector<pair<string, shared_ptr<Node>>> fired;
+    auto record = [&fired](const string& name) {
+        return [&fired, name](pattern::Matcher& m) {
+            fired.push_back({name, m.get_match_root()});
+            return false;
+        };
+    };
+
+    auto x = make_shared<pattern::op::Label>(element::f32, shape);
+    auto y = make_shared<pattern::op::Label>(element::f32, shape);
+    // Rooted at a Label with a predicate only: offered every node
+    auto any_mul = make_shared<pattern::op::Label>(
+        element::f32, shape, pattern::has_class<op::Multiply>());
+    // Rooted at Multiply
+    auto mul_pattern = make_shared<op::Multiply>(x, y);
+    // Rooted at Add wrapped in a Label
+    auto add_pattern = make_shared<op::Add>(x, y);
+    auto add_label = make_shared<pattern::op::Label>(add_pattern, nullptr, NodeVector{add_pattern});
+
+    pass::GraphRewrite rewrite;
+    rewrite.add_matcher(make_shared<pattern::Matcher>(mul_pattern), record("mul"));
+    rewrite.add_matcher(make_shared<pattern::Matcher>(any_mul), record("any_mul"));
+    rewrite.add_matcher(make_shared<pattern::Matcher>(add_label), record("add"));
+    rewrite.run_on_function(f);
+
+    ASSERT_EQ(fired.size(), 3);
+    EXPECT_EQ(fired[0], make_pair(string("mul"), shared_ptr<Node>(mul)));
+    EXPECT_EQ(fired[1], make_pair(string("any_mul"), shared_ptr<Node>(mul)));
+    EXPECT_EQ(fired[2], make_pair(string("add"), shared_ptr<Node>(add)));
+}
+
+TEST(pattern, graph_rewrite_worklist)
+{
+    // a - (-b) is rewritten to a + (-(-b)). Only a worklist revisits the new Negative, so that
+    // -(-b) is then folded to b.
+    auto make_rewrite = [](bool worklist_mode) {
+        auto rewrite = make_shared<pass::GraphRewrite>();
+        rewrite->set_worklist_mode(worklist_mode);
+
+        auto x = make_shared<pattern::op::Label>(element::f32, Shape{2});
+        auto y = make_shared<pattern::op::Label>(element::f32, Shape{2});
+        auto subtract = make_shared<op::Subtract>(x, y);
+        rewrite->add_matcher(make_shared<pattern::Matcher>(subtract),
+                             [x, y](pattern::Matcher& m) {
+                                 auto pattern_map = m.get_pattern_map();
+                                 auto add = make_shared<op::Add>(
+                                     pattern_map[x], make_shared<op::Negative>(pattern_map[y]));
+                                 replace_node(m.get_match_root(), add);
+                                 return true;
+                             });
+
+        auto z = make_shared<pattern::op::Label>(element::f32, Shape{2});
+        auto double_negative = make_shared<op::Negative>(make_shared<op::Negative>(z));
+        rewrite->add_matcher(make_shared<pattern::Matcher>(double_negative),
+                             [z](pattern::Matcher& m) {
+                                 replace_node(m.get_match_root(), m.get_pattern_map()[z]);
+                                 return true;
+                             });
+        return rewrite;
+    };
+
+    for (bool worklist_mode : {false, true})
+    {
+        auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto b = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto f = make_shared<Function>(make_shared<op::Subtract>(a, make_shared<op::Negative>(b)),
+                                       ParameterVector{a, b});
+
+        make_rewrite(worklist_mode)->run_on_function(f);
+
+        auto add = dynamic_pointer_cast<op::Add>(f->get_results().at(0)->get_argument(0));
+        ASSERT_TRUE(add);
+        EXPECT_EQ(add->get_argument(0), a);
+        EXPECT_EQ(count_ops_of_type<op::Negative>(f), worklist_mode ? 0 : 2);
+        if (worklist_mode)
+        {
+            EXPECT_EQ(add->get_argument(1), b);
+        }
+    }
+}
+
+TEST(pattern, graph_rewrite_worklist_bounded)
+{
+    // Abs and Negative are rewritten into each other forever, so the worklist has to give up
+    auto rewrite = make_shared<pass::GraphRewrite>();
+    rewrite->set_worklist_mode(true);
+    auto x = make_shared<pattern::op::Label>(element::f32, Shape{2});
+    rewrite->add_matcher(make_shared<pattern::Matcher>(make_shared<op::Abs>(x)),
+                         [x](pattern::Matcher& m) {
+                             replace_node(m.get_match_root(),
+                                          make_shared<op::Negative>(m.get_pattern_map()[x]));
+                             return true;
+                         });
+    rewrite->add_matcher(make_shared<pattern::Matcher>(make_shared<op::Negative>(x)),
+                         [x](pattern::Matcher& m) {
+                             replace_node(m.get_match_root(),
+                                          make_shared<op::Abs>(m.get_pattern_map()[x]));
+                             return true;
+                         });
+
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto f = make_shared<Function>(make_shared<op::Abs>(a), ParameterVector{a});
+    size_t num_ops = f->get_ops().size();
+    EXPECT_TRUE(rewrite->run_on_function(f));
+    EXPECT_EQ(rewrite->get_num_matchers_fired(), 10 * num_ops);
+}
+
 TEST(pattern, matcher)
 {
     Shape shape{};
@@ -729,3 +849,44 @@ TEST(pattern, is_contained_match)
     ASSERT_TRUE(n.match(label_abs2, absn2));
     ASSERT_FALSE(n.is_contained_match());
 }
+
+// Checks the result of CoreFusion on serialized models of the test zoo, which exercises the
+// matcher dispatch on graphs of up to 12k nodes
+TEST(pattern, core_fusion_zoo_models)
+{
+    struct Expected
+    {
+        string model;
+        size_t num_ops;
+        map<string, size_t> op_counts;
+    };
+    vector<Expected> expected{
+        {"mxnet/LSTM_backward.json", 12323, {{"Dot", 480}, {"Multiply", 1678}}},
+        {"mxnet/Sockeye_Seq2Seq_backward.json", 6249, {{"Dot", 239}, {"Multiply", 839}}},
+        {"mxnet/mxnet_densenet121_inference_batch1_float32.json",
+         1689,
+         {{"BatchNormInference", 62}, {"Convolution", 120}, {"Relu", 121}, {"Sqrt", 59}}},
+        {"mxnet/10_bucket_LSTM.json", 496, {{"Exp", 0}, {"Sigmoid", 60}, {"Tanh", 40}}}};
+
+    for (const Expected& e : expected)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, e.model);
+        shared_ptr<Function> f = deserialize(file_util::read_file_to_string(json_path));
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::CoreFusion>();
+        pass_manager.run_passes(f);
+
+        map<string, size_t> op_counts;
+        for (auto node : f->get_ops())
+        {
+            op_counts[node->description()]++;
+        }
+        EXPECT_EQ(f->get_ops().size(), e.num_ops) << e.model;
+        for (auto& op_count : e.op_counts)
+        {
+            EXPECT_EQ(op_counts[op_count.first], op_count.second)
+                << e.model << ": " << op_count.first;
+        }
+    }
+}
@@ -310,3 +310,23 @@ TEST(serialize, constant_infinity_nan)
     EXPECT_TRUE(test::all_close_f(c->get_vector<float>(), c_data));
     EXPECT_EQ(d->get_vector<int64_t>(), d_data);
 }
+
+TEST(serialize, node_attributes)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 1, 4, 4});
+    auto B = op::Constant::create(element::f32, Shape{1, 1, 2, 2}, {1, 2, 3, 4});
+    auto conv = make_shared<op::Convolution>(A, B, Strides{2, 2});
+
+    // Constant values are not part of the attributes and are passed back separately
+    auto new_b = deserialize_node(serialize_attributes(*B), {}, B->get_data_ptr());
+    auto new_conv = deserialize_node(serialize_attributes(*conv), {A, new_b});
+
+    auto constant = dynamic_pointer_cast<op::Constant>(new_b);
+    ASSERT_NE(constant, nullptr);
+    EXPECT_EQ(constant->get_vector<float>(), (vector<float>{1, 2, 3, 4}));
+    auto convolution = dynamic_pointer_cast<op::Convolution>(new_conv);
+    ASSERT_NE(convolution, nullptr);
+    EXPECT_EQ(convolution->get_window_movement_strides(), (Strides{2, 2}));
+    EXPECT_EQ(convolution->get_shape(), (Shape{1, 1, 2, 2}));
+    EXPECT_EQ(serialize_attributes(*new_conv), serialize_attributes(*conv));
+}